@@ -0,0 +1,869 @@
+/*@@
+  @file      bench.cc
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Standalone microbenchmark of the boundary kernels of
+             Boundary2.
+
+             The thorn sources are built against the mock flesh in
+             mock/, on a single cubic component with all faces on the
+             outer boundary.  The variables hold a smooth, TOV-like
+             profile (a uniform density star with a 1/r exterior).
+             Every BC of the thorn is timed for each combination of
+             component size, boundary width, number of variables and
+             element type given on the command line, and the boundary
+             points per second and the effective memory bandwidth are
+             reported.
+
+             Besides the registered BCs, the suite runs the fused pass
+             over Scalar, Flat, Radiation and Static, a sample
+             pointwise functor and the radiation condition on the
+             right hand side.
+
+             With compare=yes, each BC is also run on identical input
+             by its reference: the frozen kernels in reference/, the
+             separate BCs for the fused pass, and the built-in Flat for
+             the pointwise functor.  The largest absolute and relative
+             differences of the results and the speedup are reported.
+             Reference and BC are timed in alternating rounds and the
+             fastest round of each counts; a BC which comes out slower
+             is timed again before it counts as such.  The exit code is
+             non-zero if a difference exceeds the tolerance or a
+             speedup falls below min_speedup, except for the fused
+             pass, which the thorn only uses when fuse_local_bcs is
+             set.
+
+             With compare=yes, the suite finally checks that
+             Boundary_ApplyPhysicalBCsAsync gives control back to the
+             caller before the BCs it starts are applied.
+  @enddesc
+  @version   $Header$
+@@*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cctk.h"
+#include "cctk_Parameters.h"
+#include "util_Table.h"
+
+#include "Boundary2.h"
+#include "Boundary2_Pointwise.hh"
+#include "Fused.h"
+#include "mock_cctk.h"
+
+/* the reference kernels, see the Makefile */
+extern "C" {
+#define REF_BNDRY(name)                                                        \
+  CCTK_INT Ref_Bndry_##name(const cGH *GH, CCTK_INT num_vars,                  \
+                            CCTK_INT *var_indices, CCTK_INT *faces,            \
+                            CCTK_INT *widths, CCTK_INT *table_handles);
+REF_BNDRY(Scalar)
+REF_BNDRY(Flat)
+REF_BNDRY(Radiative)
+REF_BNDRY(Copy)
+REF_BNDRY(Robin)
+REF_BNDRY(Static)
+#undef REF_BNDRY
+
+CCTK_INT Bdry2_Boundary_ApplyRadiationRHS(
+    const cGH *cctkGH, CCTK_INT num_vars, const CCTK_INT *var_indices,
+    const CCTK_INT *rhs_indices, const CCTK_REAL *var0s,
+    const CCTK_REAL *speeds, CCTK_INT width, CCTK_INT radpower);
+
+CCTK_INT Bdry2_Boundary_SelectGroupsForBCI(
+    const cGH *cctkGH, CCTK_INT faces, CCTK_INT width, CCTK_INT table_handle,
+    CCTK_INT num_groups, const CCTK_INT *group_indices, const char *bc_name);
+CCTK_INT Bdry2_Boundary_ApplyPhysicalBCsToVars(const cGH *cctkGH,
+                                               CCTK_INT num_vars,
+                                               const CCTK_INT *var_indices,
+                                               CCTK_INT before);
+CCTK_INT Bdry2_Boundary_ApplyPhysicalBCsAsync(const cGH *cctkGH,
+                                              CCTK_INT num_vars,
+                                              const CCTK_INT *var_indices,
+                                              CCTK_INT before);
+CCTK_INT Bdry2_Boundary_TestPhysicalBCs(const cGH *cctkGH, CCTK_INT handle);
+CCTK_INT Bdry2_Boundary_WaitPhysicalBCs(const cGH *cctkGH, CCTK_INT handle);
+}
+
+namespace {
+
+/* the BCs the fused pass applies, in turn, to the variables of a call */
+const boundary_function fused_bcs[] = {
+    (boundary_function)Bndry_Scalar, (boundary_function)Bndry_Flat,
+    (boundary_function)Bndry_Radiative, (boundary_function)Bndry_Static};
+const int num_fused_bcs = sizeof fused_bcs / sizeof *fused_bcs;
+
+/* variable v gets fused_bcs[v % num_fused_bcs], all in one pass */
+CCTK_INT BenchFused(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
+                    CCTK_INT *faces, CCTK_INT *widths, CCTK_INT *tables) {
+  std::vector<boundary_function> funcs(num_vars);
+  for (int v = 0; v < num_vars; v++) {
+    funcs[v] = fused_bcs[v % num_fused_bcs];
+  }
+  return Boundary2::ApplyFused(GH, num_vars, vars, funcs.data(), faces,
+                               widths, tables);
+}
+
+/* the same BCs applied by their own kernels, one call per BC */
+CCTK_INT BenchSeparate(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
+                       CCTK_INT *faces, CCTK_INT *widths, CCTK_INT *tables) {
+  CCTK_INT retval = 0;
+  for (int b = 0; b < num_fused_bcs; b++) {
+    std::vector<CCTK_INT> bvars, bfaces, bwidths, btables;
+    for (int v = b; v < num_vars; v += num_fused_bcs) {
+      bvars.push_back(vars[v]);
+      bfaces.push_back(faces[v]);
+      bwidths.push_back(widths[v]);
+      btables.push_back(tables[v]);
+    }
+    if (!bvars.empty()) {
+      const CCTK_INT err =
+          fused_bcs[b](GH, bvars.size(), bvars.data(), bfaces.data(),
+                       bwidths.data(), btables.data());
+      retval = err < 0 ? err : retval;
+    }
+  }
+  return retval;
+}
+
+/**
+ * A sample pointwise functor: Flat, which sets every boundary point to
+ * the one inside it, updated already since points go inside out.
+ */
+struct PointwiseFlat : Boundary2::PointwiseTraits {
+  static const int interior_points = 1;
+  PointwiseFlat(const cGH *, CCTK_INT) {}
+  template <typename T> T operator()(const Boundary2::Point<T> &p) const {
+    return p.inner(1);
+  }
+};
+
+/**
+ * Boundary_ApplyRadiationRHS on the variables, with the right hand
+ * sides in the group after theirs; the table holds the first right
+ * hand side under RHS_FROM and the decay power under RADPOWER.
+ */
+CCTK_INT BenchRadiationRHS(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
+                           CCTK_INT *faces, CCTK_INT *widths,
+                           CCTK_INT *tables) {
+  CCTK_INT rhs_from = -1, radpower = -1;
+  Util_TableGetInt(tables[0], &rhs_from, "RHS_FROM");
+  Util_TableGetInt(tables[0], &radpower, "RADPOWER");
+  std::vector<CCTK_INT> rhs(num_vars);
+  const std::vector<CCTK_REAL> var0s(num_vars, 1.0), speeds(num_vars, 1.0);
+  for (int v = 0; v < num_vars; v++) {
+    rhs[v] = rhs_from + vars[v] - vars[0];
+  }
+  (void)faces;
+  return Bdry2_Boundary_ApplyRadiationRHS(GH, num_vars, vars, rhs.data(),
+                                          var0s.data(), speeds.data(),
+                                          widths[0], radpower);
+}
+
+/**
+ * A BC to benchmark, with its reference if there is one. The memory
+ * traffic of one boundary point is modelled as the values of the
+ * variable's type it reads and writes (neighbours are assumed to come
+ * from cache) plus the CCTK_REAL coordinates it reads. BCs with
+ * real_only set only run on CCTK_REAL variables. The speedup of BCs
+ * with opt_in set, which the thorn only uses when a parameter asks for
+ * them, is reported but does not count as a regression.
+ */
+struct BenchBC {
+  const char *name;
+  boundary_function func, ref;
+  int values, coords;
+  int max_width;
+  bool real_only;
+  bool opt_in;
+};
+
+const BenchBC bench_bcs[] = {
+    {"scalar", (boundary_function)Bndry_Scalar, Ref_Bndry_Scalar, 1, 0, 0,
+     false, false},
+    {"flat", (boundary_function)Bndry_Flat, Ref_Bndry_Flat, 2, 0, 0, false,
+     false},
+    {"radiation", (boundary_function)Bndry_Radiative, Ref_Bndry_Radiative, 3,
+     2, 0, false, false},
+    {"copy", (boundary_function)Bndry_Copy, Ref_Bndry_Copy, 2, 0, 0, false,
+     false},
+    {"robin", (boundary_function)Bndry_Robin, Ref_Bndry_Robin, 2, 2, 2, false,
+     false},
+    {"static", (boundary_function)Bndry_Static, Ref_Bndry_Static, 2, 0, 0,
+     false, false},
+    {"extrapolate", (boundary_function)Bndry_Extrapolate, NULL, 3, 0, 0,
+     false, false},
+    {"outflow", (boundary_function)Bndry_Outflow, NULL, 2, 0, 0, false,
+     false},
+    {"none", (boundary_function)Bndry_None, NULL, 0, 0, 0, false, false},
+    /* fuse_local_bcs is off by default */
+    {"fused", BenchFused, BenchSeparate, 2, 1, 0, false, true},
+    {"pointwise", (boundary_function)Boundary2::PointwiseBC<PointwiseFlat>,
+     (boundary_function)Bndry_Flat, 2, 0, 0, false, false},
+    {"rhs", BenchRadiationRHS, NULL, 5, 2, 0, true, false},
+    {"rhs_decay", BenchRadiationRHS, NULL, 7, 2, 0, true, false},
+};
+
+struct BenchType {
+  const char *name;
+  int vtype;
+};
+
+const BenchType bench_types[] = {
+    {"real", CCTK_VARIABLE_REAL},
+    {"real8", CCTK_VARIABLE_REAL8},
+    {"real4", CCTK_VARIABLE_REAL4},
+};
+
+struct Options {
+  std::vector<std::string> bcs, types;
+  std::vector<int> sizes, widths, nvars;
+  double min_time;
+  bool csv;
+  bool compare, async;
+  double tolerance, min_speedup;
+};
+
+std::vector<std::string> SplitList(const std::string &s) {
+  std::vector<std::string> items;
+  std::istringstream in(s);
+  std::string item;
+  while (std::getline(in, item, ',')) {
+    if (!item.empty()) {
+      items.push_back(item);
+    }
+  }
+  return items;
+}
+
+std::vector<int> SplitInts(const std::string &s) {
+  std::vector<int> items;
+  for (const std::string &item : SplitList(s)) {
+    items.push_back(atoi(item.c_str()));
+  }
+  return items;
+}
+
+void Usage(const char *argv0) {
+  fprintf(stderr,
+          "usage: %s [key=value ...]\n"
+          "  bcs=all|name,...      BCs to run (default all)\n"
+          "  types=real,real4      element types (default real,real4;\n"
+          "                        also real8)\n"
+          "  sizes=16,32,64,128    points per direction of the component\n"
+          "  widths=1,2,3          boundary widths\n"
+          "  nvars=1,8             variables per call\n"
+          "  min_time=0.2          seconds to spend per measurement\n"
+          "  openmp=yes|no         thread the kernels (default yes)\n"
+          "  csv=yes|no            print comma separated values\n"
+          "  compare=yes|no        compare with the reference kernels\n"
+          "  tolerance=0           largest relative difference accepted\n"
+          "  min_speedup=0.95      smallest speedup accepted\n"
+          "  async=yes|no          with compare, check that asynchronous\n"
+          "                        BCs return before they are applied\n",
+          argv0);
+  exit(1);
+}
+
+bool ParseBool(const std::string &s) {
+  return s == "yes" || s == "true" || s == "1";
+}
+
+Options ParseOptions(int argc, char **argv) {
+  Options o;
+  o.bcs = SplitList("all");
+  o.types = SplitList("real,real4");
+  o.sizes = SplitInts("16,32,64,128");
+  o.widths = SplitInts("1,2,3");
+  o.nvars = SplitInts("1,8");
+  o.min_time = 0.2;
+  o.csv = false;
+  o.compare = false;
+  o.async = true;
+  o.tolerance = 0;
+  o.min_speedup = 0.95;
+  for (int i = 1; i < argc; i++) {
+    const char *eq = strchr(argv[i], '=');
+    if (!eq) {
+      Usage(argv[0]);
+    }
+    const std::string key(argv[i], eq - argv[i]), value(eq + 1);
+    if (key == "bcs") {
+      o.bcs = SplitList(value);
+    } else if (key == "types") {
+      o.types = SplitList(value);
+    } else if (key == "sizes") {
+      o.sizes = SplitInts(value);
+    } else if (key == "widths") {
+      o.widths = SplitInts(value);
+    } else if (key == "nvars") {
+      o.nvars = SplitInts(value);
+    } else if (key == "min_time") {
+      o.min_time = atof(value.c_str());
+    } else if (key == "openmp") {
+      Bench_Params.use_openmp = ParseBool(value);
+    } else if (key == "csv") {
+      o.csv = ParseBool(value);
+    } else if (key == "compare") {
+      o.compare = ParseBool(value);
+    } else if (key == "async") {
+      o.async = ParseBool(value);
+    } else if (key == "tolerance") {
+      o.tolerance = atof(value.c_str());
+    } else if (key == "min_speedup") {
+      o.min_speedup = atof(value.c_str());
+    } else {
+      Usage(argv[0]);
+    }
+  }
+  return o;
+}
+
+/**
+ * The mock component: one cube of n^3 points with coordinates x, y,
+ * z and r, and storage for the variables of the benchmark.
+ */
+class Component {
+public:
+  explicit Component(int coord_group) : coord_group(coord_group) {
+    memset(&GH, 0, sizeof GH);
+    for (int d = 0; d < 3; d++) {
+      bbox[2 * d] = bbox[2 * d + 1] = 1;
+      lbnd[d] = 0;
+      levfac[d] = 1;
+      nghostzones[d] = 3;
+    }
+    GH.cctk_dim = 3;
+    GH.cctk_lsh = lsh;
+    GH.cctk_gsh = lsh;
+    GH.cctk_ash = lsh;
+    GH.cctk_bbox = bbox;
+    GH.cctk_lbnd = lbnd;
+    GH.cctk_levfac = levfac;
+    GH.cctk_nghostzones = nghostzones;
+    GH.cctk_delta_space = delta_space;
+    GH.cctk_origin_space = origin_space;
+    GH.cctk_timefac = 1;
+    GH.cctk_convfac = 2;
+  }
+
+  /* resize to n^3 points and reset all variables */
+  void Resize(int n) {
+    for (int d = 0; d < 3; d++) {
+      lsh[d] = n;
+      /* a cube of side 20 whose points avoid the origin */
+      delta_space[d] = 20.0 / n;
+      origin_space[d] = -10.0 + 0.5 * delta_space[d];
+    }
+    GH.cctk_delta_time = 0.25 * delta_space[0];
+    npoints = size_t(n) * n * n;
+    storage.clear();
+    data.assign(CCTK_NumVars(), std::vector<void *>(2, NULL));
+    pointers.resize(CCTK_NumVars());
+    for (int v = 0; v < CCTK_NumVars(); v++) {
+      pointers[v] = data[v].data();
+    }
+    GH.data = pointers.data();
+
+    const int c0 = CCTK_FirstVarIndexI(coord_group);
+    for (int c = 0; c < 4; c++) {
+      data[c0 + c][0] = Allocate(sizeof(CCTK_REAL));
+    }
+    CCTK_REAL *x = (CCTK_REAL *)data[c0][0], *y = (CCTK_REAL *)data[c0 + 1][0],
+              *z = (CCTK_REAL *)data[c0 + 2][0],
+              *r = (CCTK_REAL *)data[c0 + 3][0];
+    for (int k = 0; k < n; k++) {
+      for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+          const int idx = CCTK_GFINDEX3D(&GH, i, j, k);
+          x[idx] = origin_space[0] + i * delta_space[0];
+          y[idx] = origin_space[1] + j * delta_space[1];
+          z[idx] = origin_space[2] + k * delta_space[2];
+          r[idx] = sqrt(x[idx] * x[idx] + y[idx] * y[idx] + z[idx] * z[idx]);
+        }
+      }
+    }
+  }
+
+  /* give the variables of a group storage and initial data */
+  void Fill(int group) {
+    const int vtype = CCTK_VarTypeI(CCTK_FirstVarIndexI(group));
+    const CCTK_REAL *r =
+        (const CCTK_REAL *)data[CCTK_FirstVarIndexI(coord_group) + 3][0];
+    const int first = CCTK_FirstVarIndexI(group);
+    for (int v = first; v < first + CCTK_NumVarsInGroupI(group); v++) {
+      for (int tl = 0; tl < 2; tl++) {
+        data[v][tl] = Allocate(CCTK_VarTypeSize(vtype));
+        const double amplitude = 1 + 0.05 * (v - first) - 0.01 * tl;
+        for (size_t p = 0; p < npoints; p++) {
+          const double value = amplitude * Profile(r[p]);
+          if (vtype == CCTK_VARIABLE_REAL4) {
+            ((CCTK_REAL4 *)data[v][tl])[p] = CCTK_REAL4(value);
+          } else if (vtype == CCTK_VARIABLE_REAL) {
+            ((CCTK_REAL *)data[v][tl])[p] = CCTK_REAL(value);
+          } else {
+            ((CCTK_REAL8 *)data[v][tl])[p] = CCTK_REAL8(value);
+          }
+        }
+      }
+    }
+  }
+
+  void *Data(int var, int tl) { return data[var][tl]; }
+
+  cGH GH;
+  size_t npoints;
+
+private:
+  /* lapse-like profile of a uniform density star of radius 4 */
+  static double Profile(double r) {
+    const double M = 1, R = 4;
+    const double phi =
+        r < R ? -M * (3 * R * R - r * r) / (2 * R * R * R) : -M / r;
+    return 1 + phi;
+  }
+
+  void *Allocate(size_t elsize) {
+    storage.push_back(std::vector<char>(npoints * elsize + 64));
+    return storage.back().data();
+  }
+
+  int coord_group;
+  int lsh[3], bbox[6], lbnd[3], levfac[3], nghostzones[3];
+  CCTK_REAL delta_space[3], origin_space[3];
+  std::vector<std::vector<char>> storage;
+  std::vector<std::vector<void *>> data;
+  std::vector<void **> pointers;
+};
+
+/* number of boundary points a BC of the given width updates */
+double BoundaryPoints(int n, int width) {
+  return 6.0 * width * n * n;
+}
+
+/**
+ * Table with the arguments a BC needs for the variables of group; the
+ * group after it is the source of Copy and holds the right hand sides
+ * of the radiation condition. Outflow treats the first three variables
+ * of the group as the velocity.
+ */
+int MakeTable(const BenchBC &bc, int group) {
+  const int table = Util_TableCreate(UTIL_TABLE_FLAGS_DEFAULT);
+  const bool fused = !strcmp(bc.name, "fused");
+  if (!strcmp(bc.name, "scalar") || fused) {
+    Util_TableSetReal(table, 0.5, "SCALAR");
+  }
+  if (!strcmp(bc.name, "radiation") || fused) {
+    Util_TableSetReal(table, 1.0, "LIMIT");
+    Util_TableSetReal(table, 1.0, "SPEED");
+  }
+  if (!strcmp(bc.name, "robin")) {
+    Util_TableSetReal(table, 1.0, "FINF");
+    Util_TableSetInt(table, 1, "DECAY_POWER");
+  } else if (!strcmp(bc.name, "copy")) {
+    Util_TableSetInt(table, CCTK_FirstVarIndexI(group + 1), "COPY_FROM");
+  } else if (!strcmp(bc.name, "extrapolate")) {
+    Util_TableSetInt(table, 2, "ORDER");
+  } else if (!strcmp(bc.name, "outflow")) {
+    char *name = CCTK_GroupName(group);
+    Util_TableSetString(table, name, "VELOCITY");
+    free(name);
+  } else if (!strncmp(bc.name, "rhs", 3)) {
+    Util_TableSetInt(table, CCTK_FirstVarIndexI(group + 1), "RHS_FROM");
+    Util_TableSetInt(table, strcmp(bc.name, "rhs") ? 2 : -1, "RADPOWER");
+  }
+  return table;
+}
+
+/* rounds a measurement is split into */
+const int time_rounds = 8;
+
+/* how often a BC which comes out slower than its reference is timed
+   again before it counts as a regression */
+const int slow_retries = 2;
+
+/**
+ * Call the BC func and, if ref is not NULL, its reference for nvars
+ * variables in alternating rounds until min_time has passed, so that
+ * both see the same state of the machine. Sets seconds and
+ * ref_seconds to the mean time per call of the fastest round of
+ * each, or to a negative value if the BC failed.
+ */
+void TimeBC(const cGH *GH, boundary_function func, boundary_function ref,
+            int first_var, int nvars, int width, int table, double min_time,
+            double &seconds, double &ref_seconds) {
+  std::vector<CCTK_INT> vars(nvars), faces(nvars, CCTK_ALL_FACES),
+      widths(nvars, width), tables(nvars, table);
+  for (int v = 0; v < nvars; v++) {
+    vars[v] = first_var + v;
+  }
+  auto call = [&](boundary_function f) {
+    return f(GH, nvars, vars.data(), faces.data(), widths.data(),
+             tables.data());
+  };
+  auto round = [&](boundary_function f, double round_time) {
+    long calls = 0;
+    double elapsed = 0;
+    const auto start = std::chrono::steady_clock::now();
+    while (calls < 2 || elapsed < round_time) {
+      call(f);
+      calls++;
+      elapsed = std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - start)
+                    .count();
+    }
+    return elapsed / calls;
+  };
+
+  seconds = call(func) < 0 ? -1 : 0;
+  ref_seconds = !ref || call(ref) < 0 ? -1 : 0;
+  if (seconds < 0) {
+    return;
+  }
+  const double round_time =
+      min_time / (time_rounds * (ref_seconds < 0 ? 1 : 2));
+  for (int r = 0; r < time_rounds; r++) {
+    const double t = round(func, round_time);
+    seconds = r == 0 ? t : std::min(seconds, t);
+    if (ref_seconds >= 0) {
+      const double t_ref = round(ref, round_time);
+      ref_seconds = r == 0 ? t_ref : std::min(ref_seconds, t_ref);
+    }
+  }
+}
+
+/**
+ * The current level of nvars variables, so that a BC can be applied
+ * to the same input twice.
+ */
+std::vector<std::vector<char>> SaveVars(Component &comp, int first_var,
+                                        int nvars) {
+  const size_t bytes =
+      comp.npoints * CCTK_VarTypeSize(CCTK_VarTypeI(first_var));
+  std::vector<std::vector<char>> saved;
+  for (int v = first_var; v < first_var + nvars; v++) {
+    const char *p = (const char *)comp.Data(v, 0);
+    saved.push_back(std::vector<char>(p, p + bytes));
+  }
+  return saved;
+}
+
+void RestoreVars(Component &comp, int first_var,
+                 const std::vector<std::vector<char>> &saved) {
+  for (size_t v = 0; v < saved.size(); v++) {
+    memcpy(comp.Data(first_var + v, 0), saved[v].data(), saved[v].size());
+  }
+}
+
+template <typename T>
+void Differences(const T *a, const T *b, size_t n, double &max_abs,
+                 double &max_rel) {
+  for (size_t p = 0; p < n; p++) {
+    const double diff = fabs(double(a[p]) - double(b[p]));
+    max_abs = std::max(max_abs, diff);
+    if (diff > 0) {
+      max_rel = std::max(max_rel, diff / std::max(fabs(double(b[p])), 1e-300));
+    }
+  }
+}
+
+/**
+ * Apply the BC once with the new and once with the reference kernel
+ * to the same input, and compute the largest differences of the
+ * results. Returns false if either kernel failed.
+ */
+bool CompareBC(Component &comp, const BenchBC &bc, int first_var, int nvars,
+               int width, int table, double &max_abs, double &max_rel) {
+  std::vector<CCTK_INT> vars(nvars), faces(nvars, CCTK_ALL_FACES),
+      widths(nvars, width), tables(nvars, table);
+  for (int v = 0; v < nvars; v++) {
+    vars[v] = first_var + v;
+  }
+  const std::vector<std::vector<char>> input =
+      SaveVars(comp, first_var, nvars);
+  const CCTK_INT ref_err = bc.ref(&comp.GH, nvars, vars.data(), faces.data(),
+                                  widths.data(), tables.data());
+  const std::vector<std::vector<char>> expected =
+      SaveVars(comp, first_var, nvars);
+  RestoreVars(comp, first_var, input);
+  const CCTK_INT err = bc.func(&comp.GH, nvars, vars.data(), faces.data(),
+                               widths.data(), tables.data());
+
+  max_abs = max_rel = 0;
+  for (int v = 0; v < nvars; v++) {
+    const void *got = comp.Data(first_var + v, 0);
+    if (CCTK_VarTypeI(first_var) == CCTK_VARIABLE_REAL4) {
+      Differences((const CCTK_REAL4 *)got,
+                  (const CCTK_REAL4 *)expected[v].data(), comp.npoints,
+                  max_abs, max_rel);
+    } else if (CCTK_VarTypeI(first_var) == CCTK_VARIABLE_REAL) {
+      Differences((const CCTK_REAL *)got,
+                  (const CCTK_REAL *)expected[v].data(), comp.npoints,
+                  max_abs, max_rel);
+    } else {
+      Differences((const CCTK_REAL8 *)got,
+                  (const CCTK_REAL8 *)expected[v].data(), comp.npoints,
+                  max_abs, max_rel);
+    }
+  }
+  RestoreVars(comp, first_var, input);
+  return err >= 0 && ref_err >= 0;
+}
+
+/**
+ * Check that Boundary_ApplyPhysicalBCsAsync hands the BCs to the
+ * background: the variables of the groups are selected for Radiation,
+ * and the time the call takes to return is compared with the time
+ * Boundary_ApplyPhysicalBCsToVars takes to apply the same BCs. The
+ * call must return in less than half of that, with
+ * Boundary_TestPhysicalBCs reporting the BCs as still running, and
+ * Boundary_WaitPhysicalBCs must leave the same result. The fastest of
+ * time_rounds attempts counts. Returns the status.
+ */
+const char *CheckAsync(Component &comp, const std::vector<int> &groups,
+                       int width, double &return_seconds,
+                       double &apply_seconds) {
+  const cGH *GH = &comp.GH;
+  std::vector<CCTK_INT> group_indices(groups.begin(), groups.end()), vars;
+  for (int group : groups) {
+    const int first = CCTK_FirstVarIndexI(group);
+    for (int v = first; v < first + CCTK_NumVarsInGroupI(group); v++) {
+      vars.push_back(v);
+    }
+  }
+  const int table = Util_TableCreate(UTIL_TABLE_FLAGS_DEFAULT);
+  Util_TableSetReal(table, 1.0, "LIMIT");
+  Util_TableSetReal(table, 1.0, "SPEED");
+  Bdry2_Boundary_RegisterPhysicalBCPhase(
+      GH, (boundary_function)Bndry_Radiative, "radiation", 1);
+  Bdry2_Boundary_SelectGroupsForBCI(GH, CCTK_ALL_FACES, width, table,
+                                    group_indices.size(),
+                                    group_indices.data(), "radiation");
+
+  std::vector<std::vector<std::vector<char>>> input, expected;
+  for (int group : groups) {
+    input.push_back(SaveVars(comp, CCTK_FirstVarIndexI(group),
+                             CCTK_NumVarsInGroupI(group)));
+  }
+  auto restore = [&]() {
+    for (size_t g = 0; g < groups.size(); g++) {
+      RestoreVars(comp, CCTK_FirstVarIndexI(groups[g]), input[g]);
+    }
+  };
+  auto seconds_since = [](std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         start)
+        .count();
+  };
+
+  bool ok = true, returned_early = false;
+  for (int r = 0; r < time_rounds; r++) {
+    restore();
+    const auto start = std::chrono::steady_clock::now();
+    ok &= Bdry2_Boundary_ApplyPhysicalBCsToVars(GH, vars.size(), vars.data(),
+                                                -1) >= 0;
+    const double t = seconds_since(start);
+    apply_seconds = r == 0 ? t : std::min(apply_seconds, t);
+  }
+  for (int group : groups) {
+    expected.push_back(SaveVars(comp, CCTK_FirstVarIndexI(group),
+                                CCTK_NumVarsInGroupI(group)));
+  }
+
+  bool same = true;
+  for (int r = 0; r < time_rounds; r++) {
+    restore();
+    const auto start = std::chrono::steady_clock::now();
+    const CCTK_INT handle = Bdry2_Boundary_ApplyPhysicalBCsAsync(
+        GH, vars.size(), vars.data(), -1);
+    const double t = seconds_since(start);
+    const bool running = Bdry2_Boundary_TestPhysicalBCs(GH, handle) == 0;
+    ok &= handle > 0 && Bdry2_Boundary_WaitPhysicalBCs(GH, handle) >= 0;
+    return_seconds = r == 0 ? t : std::min(return_seconds, t);
+    returned_early |= running && t < 0.5 * apply_seconds;
+    for (size_t g = 0; g < groups.size(); g++) {
+      same &= SaveVars(comp, CCTK_FirstVarIndexI(groups[g]),
+                       CCTK_NumVarsInGroupI(groups[g])) == expected[g];
+    }
+  }
+  restore();
+  Util_TableDestroy(table);
+  return !ok ? "error" : !same ? "DIFFERS" : !returned_early ? "BLOCKS" : "ok";
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const Options o = ParseOptions(argc, argv);
+
+  const int coord_group =
+      Mock_CreateGroup("coordinates", CCTK_GF, CCTK_VARIABLE_REAL, 3, 4, 1);
+  const int c0 = CCTK_FirstVarIndexI(coord_group);
+  Mock_SetCoordinates(c0, c0 + 1, c0 + 2, c0 + 3);
+
+  std::vector<const BenchBC *> bcs;
+  for (const BenchBC &bc : bench_bcs) {
+    if (std::find(o.bcs.begin(), o.bcs.end(), "all") != o.bcs.end() ||
+        std::find(o.bcs.begin(), o.bcs.end(), bc.name) != o.bcs.end()) {
+      bcs.push_back(&bc);
+    }
+  }
+  std::vector<const BenchType *> types;
+  for (const BenchType &t : bench_types) {
+    if (std::find(o.types.begin(), o.types.end(), t.name) != o.types.end()) {
+      types.push_back(&t);
+    }
+  }
+  if (bcs.empty() || types.empty()) {
+    Usage(argv[0]);
+  }
+
+  /* two groups per type and variable count, the second one being the
+     source of Copy */
+  std::map<std::pair<int, int>, int> groups;
+  for (const BenchType *t : types) {
+    for (int nvars : o.nvars) {
+      char name[64];
+      snprintf(name, sizeof name, "%s_%d", t->name, nvars);
+      groups[std::make_pair(t->vtype, nvars)] =
+          Mock_CreateGroup(name, CCTK_GF, t->vtype, 3, nvars, 2);
+      snprintf(name, sizeof name, "%s_%d_from", t->name, nvars);
+      Mock_CreateGroup(name, CCTK_GF, t->vtype, 3, nvars, 2);
+    }
+  }
+
+  if (o.csv) {
+    printf("bc,type,size,width,nvars,points,seconds,points_per_s,gb_per_s%s\n",
+           o.compare ? ",ref_seconds,speedup,max_abs_diff,max_rel_diff,status"
+                     : "");
+  } else {
+    printf("%-11s %-6s %5s %5s %5s %10s %12s %12s %9s", "bc", "type", "size",
+           "width", "nvars", "points", "us/call", "Mpoints/s", "GB/s");
+    if (o.compare) {
+      printf(" %12s %8s %10s %10s  %s", "ref us/call", "speedup", "max abs",
+             "max rel", "status");
+    }
+    printf("\n");
+  }
+  int failures = 0;
+
+  Component comp(coord_group);
+  for (int n : o.sizes) {
+    comp.Resize(n);
+    for (const auto &g : groups) {
+      comp.Fill(g.second);
+      comp.Fill(g.second + 1);
+    }
+    for (const BenchBC *bc : bcs) {
+      for (const BenchType *t : types) {
+        for (int width : o.widths) {
+          if ((bc->max_width && width > bc->max_width) ||
+              (bc->real_only && t->vtype != CCTK_VARIABLE_REAL)) {
+            continue;
+          }
+          for (int nvars : o.nvars) {
+            const int group = groups.at(std::make_pair(t->vtype, nvars));
+            const int first = CCTK_FirstVarIndexI(group);
+            const int table = MakeTable(*bc, group);
+            const bool compare = o.compare && bc->ref;
+            double max_abs = 0, max_rel = 0, seconds, ref_seconds;
+            bool ok = true;
+            if (compare) {
+              ok = CompareBC(comp, *bc, first, nvars, width, table, max_abs,
+                             max_rel);
+            }
+            TimeBC(&comp.GH, bc->func, compare ? bc->ref : NULL, first, nvars,
+                   width, table, o.min_time, seconds, ref_seconds);
+            /* a slowdown has to show up again to count, so that a noisy
+               measurement does not fail the comparison */
+            for (int retry = 0;
+                 compare && !bc->opt_in && retry < slow_retries &&
+                 seconds > 0 && ref_seconds > 0 &&
+                 ref_seconds / seconds < o.min_speedup;
+                 retry++) {
+              double again, ref_again;
+              TimeBC(&comp.GH, bc->func, bc->ref, first, nvars, width, table,
+                     o.min_time, again, ref_again);
+              if (again > 0 && ref_again > 0 &&
+                  ref_again / again > ref_seconds / seconds) {
+                seconds = again;
+                ref_seconds = ref_again;
+              }
+            }
+            Util_TableDestroy(table);
+
+            const double points = BoundaryPoints(n, width) * nvars;
+            const double bytes =
+                points * (bc->values * CCTK_VarTypeSize(t->vtype) +
+                          bc->coords * sizeof(CCTK_REAL));
+            if (seconds < 0) {
+              printf(o.csv ? "%s,%s,%d,%d,%d,%.0f,error,,\n"
+                           : "%-11s %-6s %5d %5d %5d %10.0f %12s\n",
+                     bc->name, t->name, n, width, nvars, points, "error");
+              failures++;
+              continue;
+            }
+            if (o.csv) {
+              printf("%s,%s,%d,%d,%d,%.0f,%g,%g,%g", bc->name, t->name, n,
+                     width, nvars, points, seconds, points / seconds,
+                     bytes / seconds * 1e-9);
+            } else {
+              printf("%-11s %-6s %5d %5d %5d %10.0f %12.2f %12.1f %9.2f",
+                     bc->name, t->name, n, width, nvars, points, seconds * 1e6,
+                     points / seconds * 1e-6, bytes / seconds * 1e-9);
+            }
+            if (compare) {
+              const double speedup = ref_seconds / seconds;
+              const bool accepted = speedup >= o.min_speedup || bc->opt_in;
+              const char *status =
+                  !ok || ref_seconds < 0       ? "error"
+                  : max_rel > o.tolerance      ? "DIFFERS"
+                  : !accepted                  ? "SLOWER"
+                  : speedup < o.min_speedup    ? "ok, opt-in"
+                                               : "ok";
+              failures += strncmp(status, "ok", 2) != 0;
+              printf(o.csv ? ",%g,%g,%g,%g,%s" : " %12.2f %8.2f %10.3g %10.3g  %s",
+                     ref_seconds * (o.csv ? 1 : 1e6), speedup, max_abs, max_rel,
+                     status);
+            }
+            printf("\n");
+            fflush(stdout);
+          }
+        }
+      }
+    }
+  }
+  if (o.compare && o.async) {
+    /* all variables of the largest size, so that the BCs take long
+       enough for the calling thread to be scheduled again meanwhile */
+    std::vector<int> async_groups;
+    for (const auto &g : groups) {
+      async_groups.push_back(g.second);
+      async_groups.push_back(g.second + 1);
+    }
+    double return_seconds, apply_seconds;
+    const char *status =
+        CheckAsync(comp, async_groups, *std::max_element(o.widths.begin(),
+                                                         o.widths.end()),
+                   return_seconds, apply_seconds);
+    failures += strcmp(status, "ok") != 0;
+    printf(o.csv ? "async,%g,%g,%s\n"
+                 : "async: returns after %.2f us, BCs take %.2f us  %s\n",
+           return_seconds * (o.csv ? 1 : 1e6),
+           apply_seconds * (o.csv ? 1 : 1e6), status);
+  }
+  if (o.compare) {
+    printf("%d regression%s\n", failures, failures == 1 ? "" : "s");
+  }
+  return failures != 0;
+}
@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+# Generate a cctk_Parameters.h for the benchmark from param.ccl.
+#
+# All parameters of Boundary2 become members of the struct Bench_Params,
+# whose defaults are given by BENCH_PARAMS_DEFAULTS, so that the
+# benchmark can change them at run time.  DECLARE_CCTK_PARAMETERS copies
+# the current values into local constants, as in Cactus.
+
+import re
+import sys
+
+CTYPE = {'INT': 'CCTK_INT', 'BOOLEAN': 'CCTK_INT', 'REAL': 'CCTK_REAL',
+         'KEYWORD': 'const char *', 'STRING': 'const char *'}
+
+PARAM = re.compile(r'^\s*(INT|REAL|BOOLEAN|KEYWORD|STRING)\s+(\w+)\s*'
+                   r'"[^"]*".*?\{.*?\}\s*(\S+)', re.M | re.S)
+
+
+def default(ptype, value):
+    if ptype == 'BOOLEAN':
+        return '1' if value.strip('"').lower() in ('yes', 'true', '1') else '0'
+    if ptype in ('KEYWORD', 'STRING'):
+        return value if value.startswith('"') else '"%s"' % value
+    return value.strip('"')
+
+
+def main():
+    params = [(m.group(1), m.group(2), default(m.group(1), m.group(3)))
+              for m in PARAM.finditer(open(sys.argv[1]).read())]
+    out = ['/* generated by gen_params.py from param.ccl, do not edit */',
+           '#ifndef _CCTK_PARAMETERS_H_',
+           '#define _CCTK_PARAMETERS_H_',
+           '',
+           '#include "cctk.h"',
+           '',
+           'struct Bench_Params_t {']
+    out += ['  %s %s;' % (CTYPE[t], n) for t, n, _ in params]
+    out += ['};',
+            '',
+            '#ifdef __cplusplus',
+            'extern "C" {',
+            '#endif',
+            'extern struct Bench_Params_t Bench_Params;',
+            '#ifdef __cplusplus',
+            '}',
+            '#endif',
+            '',
+            '#define BENCH_PARAMS_DEFAULTS \\',
+            '  { %s }' % ', '.join(d for _, _, d in params),
+            '',
+            '#define DECLARE_CCTK_PARAMETERS \\']
+    out += ['  %s const %s __attribute__((unused)) = Bench_Params.%s; \\'
+            % (CTYPE[t], n, n) for t, n, _ in params]
+    out += ['', '#endif /* _CCTK_PARAMETERS_H_ */']
+    print('\n'.join(out))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,26 @@
+/*@@
+  @file      PreSync.h
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Stand-in for the header of the PreSync driver interface,
+             declaring the type of a boundary condition function
+  @enddesc
+  @version   $Header$
+@@*/
+
+#ifndef _PRESYNC_H_
+#define _PRESYNC_H_
+#include "cctk.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+typedef CCTK_INT (*boundary_function)(const cGH *cctkGH, CCTK_INT num_vars,
+    CCTK_INT *var_indices, CCTK_INT *faces, CCTK_INT *widths,
+    CCTK_INT *table_handles);
+CCTK_INT Boundary_RegisterPhysicalBC(CCTK_POINTER_TO_CONST GH,
+    boundary_function func, CCTK_STRING bc_name);
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,112 @@
+/*@@
+  @file      cctk.h
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Minimal stand-in for the flesh header, providing just what
+             the Boundary2 sources need to be built outside of Cactus
+             for benchmarking (see mock_cctk.c)
+  @enddesc
+  @version   $Header$
+@@*/
+
+#ifndef _CCTK_H_
+#define _CCTK_H_
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+typedef int CCTK_INT;
+typedef double CCTK_REAL;
+typedef float CCTK_REAL4;
+typedef double CCTK_REAL8;
+typedef signed char CCTK_INT1;
+typedef short CCTK_INT2;
+typedef int CCTK_INT4;
+typedef long long CCTK_INT8;
+typedef unsigned char CCTK_BYTE;
+#ifdef __cplusplus
+}
+#include <complex>
+typedef std::complex<double> CCTK_COMPLEX;
+extern "C" {
+#else
+typedef double _Complex CCTK_COMPLEX;
+#endif
+typedef void *CCTK_POINTER;
+typedef const void *CCTK_POINTER_TO_CONST;
+typedef const char *CCTK_STRING;
+#define HAVE_CCTK_INT1 1
+#define HAVE_CCTK_INT2 1
+#define HAVE_CCTK_INT4 1
+#define HAVE_CCTK_INT8 1
+#define HAVE_CCTK_REAL4 1
+#define HAVE_CCTK_REAL8 1
+enum { CCTK_VARIABLE_VOID = 100, CCTK_VARIABLE_BYTE = 110, CCTK_VARIABLE_INT = 120,
+  CCTK_VARIABLE_INT1, CCTK_VARIABLE_INT2, CCTK_VARIABLE_INT4, CCTK_VARIABLE_INT8,
+  CCTK_VARIABLE_REAL = 130, CCTK_VARIABLE_REAL4, CCTK_VARIABLE_REAL8, CCTK_VARIABLE_REAL16,
+  CCTK_VARIABLE_COMPLEX = 140, CCTK_VARIABLE_STRING = 150, CCTK_VARIABLE_CHAR, CCTK_VARIABLE_POINTER = 160 };
+enum { CCTK_SCALAR = 0, CCTK_ARRAY = 1, CCTK_GF = 2 };
+#define CCTK_ALL_FACES (-1)
+#define CCTK_THORNSTRING "Boundary2"
+typedef struct cGH {
+  int cctk_dim, cctk_iteration;
+  int *cctk_gsh, *cctk_lsh, *cctk_lbnd, *cctk_ubnd, *cctk_ash, *cctk_bbox;
+  int *cctk_nghostzones, *cctk_levfac, *cctk_levoff, *cctk_levoffdenom;
+  int cctk_timefac, cctk_convlevel, cctk_convfac;
+  CCTK_REAL cctk_delta_time, cctk_time;
+  CCTK_REAL *cctk_delta_space, *cctk_origin_space;
+  void ***data;
+} cGH;
+#define CCTK_GFINDEX3D(GH, i, j, k) \
+  ((i) + (GH)->cctk_ash[0] * ((j) + (GH)->cctk_ash[1] * (k)))
+int CCTK_VWarn(int level, int line, const char *file, const char *thorn,
+               const char *fmt, ...);
+void CCTK_VError(int line, const char *file, const char *thorn,
+                 const char *fmt, ...);
+void CCTK_Error(int line, const char *file, const char *thorn, const char *msg);
+int CCTK_VInfo(const char *thorn, const char *fmt, ...);
+int CCTK_Info(const char *thorn, const char *msg);
+#define CCTK_WARN(l, m) CCTK_VWarn(l, __LINE__, __FILE__, CCTK_THORNSTRING, "%s", m)
+#define CCTK_VWARN(l, ...) CCTK_VWarn(l, __LINE__, __FILE__, CCTK_THORNSTRING, __VA_ARGS__)
+#define CCTK_ERROR(m) CCTK_Error(__LINE__, __FILE__, CCTK_THORNSTRING, m)
+#define CCTK_VERROR(...) CCTK_VError(__LINE__, __FILE__, CCTK_THORNSTRING, __VA_ARGS__)
+#define CCTK_INFO(m) CCTK_Info(CCTK_THORNSTRING, m)
+#define CCTK_VINFO(...) CCTK_VInfo(CCTK_THORNSTRING, __VA_ARGS__)
+int CCTK_GroupIndexFromVarI(int var);
+int CCTK_GroupDimI(int group);
+int CCTK_GroupDimFromVarI(int var);
+int CCTK_GroupTypeI(int group);
+int CCTK_VarTypeI(int var);
+int CCTK_VarTypeSize(int vtype);
+const char *CCTK_VarTypeName(int vtype);
+int CCTK_VarTypeNumber(const char *type);
+const char *CCTK_VarName(int var);
+char *CCTK_FullName(int var);
+char *CCTK_GroupName(int group);
+int CCTK_TimerCreate(const char *name);
+int CCTK_TimerStartI(int h);
+int CCTK_TimerStopI(int h);
+int CCTK_VarIndex(const char *name);
+int CCTK_GroupIndex(const char *name);
+int CCTK_FirstVarIndexI(int group);
+int CCTK_NumVarsInGroupI(int group);
+int CCTK_NumVars(void);
+int CCTK_NumGroups(void);
+int CCTK_DeclaredTimeLevelsVI(int var);
+int CCTK_ActiveTimeLevelsVI(const cGH *GH, int var);
+int CCTK_CoordIndex(int dir, const char *name, const char *system);
+int CCTK_CoordSystemHandle(const char *system);
+int CCTK_MaxDim(void);
+int CCTK_Equals(const char *a, const char *b);
+int CCTK_GroupStaggerDirArrayGI(CCTK_INT *stagger, int size, int group);
+int CCTK_nProcs(const cGH *GH);
+int CCTK_MyProc(const cGH *GH);
+const void *CCTK_ParameterGet(const char *name, const char *thorn, int *type);
+CCTK_INT SymmetryTableHandleForGrid(CCTK_POINTER_TO_CONST GH);
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,40 @@
+/*@@
+  @file      cctk_Arguments.h
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Stand-in for the generated argument header; the grid
+             scalars of Boundary2 live in Mock_bc_times
+  @enddesc
+  @version   $Header$
+@@*/
+
+#ifndef _CCTK_ARGUMENTS_H_
+#define _CCTK_ARGUMENTS_H_
+
+#include "cctk.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern CCTK_REAL Mock_bc_times[11];
+#ifdef __cplusplus
+}
+#endif
+
+#define CCTK_ARGUMENTS const cGH *cctkGH
+#define DECLARE_CCTK_ARGUMENTS                                                 \
+  CCTK_REAL *const bc_time_scalar = &Mock_bc_times[0];                         \
+  CCTK_REAL *const bc_time_flat = &Mock_bc_times[1];                           \
+  CCTK_REAL *const bc_time_radiation = &Mock_bc_times[2];                      \
+  CCTK_REAL *const bc_time_copy = &Mock_bc_times[3];                           \
+  CCTK_REAL *const bc_time_robin = &Mock_bc_times[4];                          \
+  CCTK_REAL *const bc_time_static = &Mock_bc_times[5];                         \
+  CCTK_REAL *const bc_time_extrapolate = &Mock_bc_times[6];                    \
+  CCTK_REAL *const bc_time_outflow = &Mock_bc_times[7];                        \
+  CCTK_REAL *const bc_time_none = &Mock_bc_times[8];                           \
+  CCTK_REAL *const bc_time_other = &Mock_bc_times[9];                          \
+  CCTK_REAL *const bc_time_total = &Mock_bc_times[10];                         \
+  const int cctk_iteration = cctkGH->cctk_iteration;
+
+#endif /* _CCTK_ARGUMENTS_H_ */
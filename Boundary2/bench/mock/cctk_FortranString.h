@@ -0,0 +1,10 @@
+/*@@
+  @file      cctk_FortranString.h
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Empty stand-in; the benchmark calls no Fortran wrappers
+  @enddesc
+  @version   $Header$
+@@*/
+
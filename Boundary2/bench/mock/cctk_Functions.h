@@ -0,0 +1,34 @@
+/*@@
+  @file      cctk_Functions.h
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Stand-in for the generated aliased function header; the
+             functions Boundary2 uses are declared in cctk.h, except
+             for the aliases it provides and calls itself
+  @enddesc
+  @version   $Header$
+@@*/
+
+#ifndef _CCTK_FUNCTIONS_H_
+#define _CCTK_FUNCTIONS_H_
+
+#include "cctk.h"
+#include "PreSync.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+CCTK_INT Boundary_RegisterPhysicalBCPhase(CCTK_POINTER_TO_CONST GH,
+                                          boundary_function func,
+                                          CCTK_STRING bc_name,
+                                          CCTK_INT before);
+CCTK_INT Boundary_RegisterPointwiseBC(CCTK_POINTER_TO_CONST GH,
+                                      boundary_function func,
+                                      CCTK_STRING bc_name, CCTK_INT pure,
+                                      CCTK_INT points_read);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CCTK_FUNCTIONS_H_ */
@@ -0,0 +1,26 @@
+/*@@
+  @file      mock_cctk.h
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Setup routines of the mock flesh: groups, coordinates and
+             the symmetry table
+  @enddesc
+  @version   $Header$
+@@*/
+
+#ifndef _MOCK_CCTK_H_
+#define _MOCK_CCTK_H_
+#include "cctk.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+int Mock_CreateGroup(const char *name, int gtype, int vtype, int dim,
+                     int nvars, int ntimelevels);
+void Mock_SetVarName(int var, const char *name);
+void Mock_SetCoordinates(int x, int y, int z, int r);
+void Mock_SetSymmetryHandles(const CCTK_INT *handles, int n);
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,22 @@
+/*@@
+  @file      util_ErrorCodes.h
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Error codes of the table routines used by Boundary2
+  @enddesc
+  @version   $Header$
+@@*/
+
+#ifndef _UTIL_ERRORCODES_H_
+#define _UTIL_ERRORCODES_H_
+
+#define UTIL_ERROR_BAD_HANDLE (-1)
+#define UTIL_ERROR_TABLE_NO_SUCH_KEY (-2)
+#define UTIL_ERROR_BAD_KEY (-3)
+#define UTIL_ERROR_TABLE_WRONG_DATA_TYPE (-4)
+#define UTIL_ERROR_TABLE_VALUE_IS_EMPTY (-5)
+#define UTIL_ERROR_NO_MEMORY (-6)
+#define UTIL_ERROR_TABLE_ITERATOR_IS_NULL (-7)
+
+#endif /* _UTIL_ERRORCODES_H_ */
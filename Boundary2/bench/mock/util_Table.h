@@ -0,0 +1,40 @@
+/*@@
+  @file      util_Table.h
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Stand-in for the key/value tables of the Cactus utility library
+  @enddesc
+  @version   $Header$
+@@*/
+
+#ifndef _UTIL_TABLE_H_
+#define _UTIL_TABLE_H_
+#include "cctk.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+#define UTIL_TABLE_FLAGS_DEFAULT 0
+int Util_TableCreate(int flags);
+int Util_TableDestroy(int handle);
+int Util_TableSetInt(int handle, CCTK_INT value, const char *key);
+int Util_TableSetReal(int handle, CCTK_REAL value, const char *key);
+int Util_TableSetString(int handle, const char *string, const char *key);
+int Util_TableSetIntArray(int handle, int N, const CCTK_INT array[], const char *key);
+int Util_TableSetRealArray(int handle, int N, const CCTK_REAL array[], const char *key);
+int Util_TableGetInt(int handle, CCTK_INT *value, const char *key);
+int Util_TableGetReal(int handle, CCTK_REAL *value, const char *key);
+int Util_TableGetString(int handle, int buffer_length, char buffer[], const char *key);
+int Util_TableGetIntArray(int handle, int N, CCTK_INT array[], const char *key);
+int Util_TableGetRealArray(int handle, int N, CCTK_REAL array[], const char *key);
+int Util_TableQueryValueInfo(int handle, CCTK_INT *type_code, CCTK_INT *N_elements, const char *key);
+int Util_TableItCreate(int handle);
+int Util_TableItDestroy(int ihandle);
+int Util_TableItQueryIsNonNull(int ihandle);
+int Util_TableItAdvance(int ihandle);
+int Util_TableItQueryKeyValueInfo(int ihandle, int key_buffer_length, char key_buffer[],
+                                  CCTK_INT *type_code, CCTK_INT *N_elements);
+#ifdef __cplusplus
+}
+#endif
+#endif
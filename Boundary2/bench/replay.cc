@@ -0,0 +1,763 @@
+/*@@
+  @file      replay.cc
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Offline replay of boundary condition calls captured by
+             Boundary2 (see capture_calls and src/Capture.cc).
+
+             The variables of the capture are recreated in the mock
+             flesh with their names, groups and types, and every call
+             of a BC of this thorn is made again on a component of the
+             captured shape, with the captured tables and symmetry
+             handles.  If the capture has the data of the calls, the
+             variables start from it and the results are compared with
+             the captured ones; otherwise they hold a smooth profile.
+             The coordinates are taken from the capture as well, or
+             computed from the origin and spacing of the component.  Each call is timed, with the kernels
+             of this thorn or the frozen reference kernels, and the
+             time per BC is reported next to the captured time.  The
+             exit code is non-zero if a call fails differently than it
+             did when captured or if a result differs by more than the
+             tolerance.
+  @enddesc
+  @version   $Header$
+@@*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <strings.h>
+
+#include "cctk.h"
+#include "cctk_Parameters.h"
+#include "util_Table.h"
+
+#include "Boundary2.h"
+#include "Capture.h"
+#include "mock_cctk.h"
+
+/* the reference kernels, see the Makefile */
+extern "C" {
+#define REF_BNDRY(name)                                                        \
+  CCTK_INT Ref_Bndry_##name(const cGH *GH, CCTK_INT num_vars,                  \
+                            CCTK_INT *var_indices, CCTK_INT *faces,            \
+                            CCTK_INT *widths, CCTK_INT *table_handles);
+REF_BNDRY(Scalar)
+REF_BNDRY(Flat)
+REF_BNDRY(Radiative)
+REF_BNDRY(Copy)
+REF_BNDRY(Robin)
+REF_BNDRY(Static)
+#undef REF_BNDRY
+}
+
+namespace {
+
+/* the BCs of this thorn by the names they are registered with; those
+   without a frozen reference replay their own kernel with
+   kernels=reference */
+struct ReplayBC {
+  const char *name;
+  boundary_function func, ref;
+};
+
+const ReplayBC replay_bcs[] = {
+    {"scalar", (boundary_function)Bndry_Scalar, Ref_Bndry_Scalar},
+    {"flat", (boundary_function)Bndry_Flat, Ref_Bndry_Flat},
+    {"radiation", (boundary_function)Bndry_Radiative, Ref_Bndry_Radiative},
+    {"copy", (boundary_function)Bndry_Copy, Ref_Bndry_Copy},
+    {"robin", (boundary_function)Bndry_Robin, Ref_Bndry_Robin},
+    {"static", (boundary_function)Bndry_Static, Ref_Bndry_Static},
+    {"extrapolate", (boundary_function)Bndry_Extrapolate,
+     (boundary_function)Bndry_Extrapolate},
+    {"outflow", (boundary_function)Bndry_Outflow,
+     (boundary_function)Bndry_Outflow},
+    {"none", (boundary_function)Bndry_None, (boundary_function)Bndry_None},
+};
+
+struct Options {
+  std::string file;
+  std::vector<std::string> bcs;
+  bool reference;
+  int repeat;
+  double tolerance;
+  bool verbose;
+};
+
+std::vector<std::string> SplitList(const std::string &s) {
+  std::vector<std::string> items;
+  std::istringstream in(s);
+  std::string item;
+  while (std::getline(in, item, ',')) {
+    if (!item.empty()) {
+      items.push_back(item);
+    }
+  }
+  return items;
+}
+
+void Usage(const char *argv0) {
+  fprintf(stderr,
+          "usage: %s [key=value ...] capture-file\n"
+          "  bcs=all|name,...      BCs to replay (default all)\n"
+          "  kernels=thorn|reference  kernels to call (default thorn)\n"
+          "  repeat=1              calls per captured call; the fastest "
+          "is reported\n"
+          "  openmp=yes|no         thread the kernels (default yes)\n"
+          "  tolerance=0           largest relative difference accepted\n"
+          "  verbose=yes|no        print every call\n",
+          argv0);
+  exit(1);
+}
+
+bool ParseBool(const std::string &s) {
+  return s == "yes" || s == "true" || s == "1";
+}
+
+Options ParseOptions(int argc, char **argv) {
+  Options o;
+  o.bcs = SplitList("all");
+  o.reference = false;
+  o.repeat = 1;
+  o.tolerance = 0;
+  o.verbose = false;
+  for (int i = 1; i < argc; i++) {
+    const char *eq = strchr(argv[i], '=');
+    if (!eq) {
+      if (!o.file.empty()) {
+        Usage(argv[0]);
+      }
+      o.file = argv[i];
+      continue;
+    }
+    const std::string key(argv[i], eq - argv[i]), value(eq + 1);
+    if (key == "bcs") {
+      o.bcs = SplitList(value);
+    } else if (key == "kernels" && (value == "thorn" || value == "reference")) {
+      o.reference = value == "reference";
+    } else if (key == "repeat") {
+      o.repeat = std::max(1, atoi(value.c_str()));
+    } else if (key == "openmp") {
+      Bench_Params.use_openmp = ParseBool(value);
+    } else if (key == "tolerance") {
+      o.tolerance = atof(value.c_str());
+    } else if (key == "verbose") {
+      o.verbose = ParseBool(value);
+    } else {
+      Usage(argv[0]);
+    }
+  }
+  if (o.file.empty()) {
+    Usage(argv[0]);
+  }
+  return o;
+}
+
+/* reads the values of a capture file, see src/Capture.cc */
+class Reader {
+public:
+  explicit Reader(const std::string &file) : pos(0) {
+    FILE *f = fopen(file.c_str(), "rb");
+    if (!f) {
+      fprintf(stderr, "Cannot open '%s'\n", file.c_str());
+      exit(1);
+    }
+    char chunk[65536];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof chunk, f)) > 0) {
+      bytes.insert(bytes.end(), chunk, chunk + n);
+    }
+    fclose(f);
+  }
+
+  bool AtEnd() const { return pos >= bytes.size(); }
+
+  const char *Take(size_t size) {
+    if (pos + size > bytes.size()) {
+      fprintf(stderr, "The capture file is truncated\n");
+      exit(1);
+    }
+    const char *p = bytes.data() + pos;
+    pos += size;
+    return p;
+  }
+  template <typename T> T Get() {
+    T value;
+    memcpy(&value, Take(sizeof value), sizeof value);
+    return value;
+  }
+  char Byte() { return Get<char>(); }
+  int Int() { return Get<int>(); }
+  double Real() { return Get<double>(); }
+  std::vector<int> Ints(int n) {
+    std::vector<int> values(n);
+    for (int &v : values) {
+      v = Int();
+    }
+    return values;
+  }
+  std::vector<double> Reals(int n) {
+    std::vector<double> values(n);
+    for (double &v : values) {
+      v = Real();
+    }
+    return values;
+  }
+  std::string String() {
+    const int n = Int();
+    return std::string(Take(n), n);
+  }
+
+private:
+  std::vector<char> bytes;
+  size_t pos;
+};
+
+struct Block {
+  int var, tl;
+  const char *data;
+  size_t bytes;
+};
+
+struct Key {
+  std::string name;
+  char kind;
+  std::vector<int> ints;
+  std::vector<double> reals;
+  std::string string;
+};
+
+struct Table {
+  int handle;
+  std::vector<Key> keys;
+};
+
+struct Call {
+  unsigned long id;
+  std::string bc_name;
+  int iteration;
+  double time, delta_time;
+  int dim;
+  std::vector<int> gsh, lsh, lbnd, ash, nghostzones, levfac, bbox, symmetry;
+  std::vector<double> origin, delta;
+  std::vector<int> coords;
+  std::vector<int> vars, faces, widths, tables;
+  std::vector<Table> table_contents;
+  std::vector<Block> before, after;
+  bool has_result;
+  int retval;
+  double seconds;
+};
+
+/* name without the implementation or thorn prefix */
+std::string StripImpl(const std::string &name) {
+  const size_t p = name.find("::");
+  return p == std::string::npos ? name : name.substr(p + 2);
+}
+
+/**
+ * The captured variables, recreated in the mock flesh. Variables whose
+ * type the mock does not know map to -1.
+ */
+class Vars {
+public:
+  void Describe(Reader &in) {
+    const int var = in.Int();
+    const std::string name = in.String(), group = in.String(),
+                      vtype_name = in.String();
+    const char gtype = in.Byte();
+    const int gdim = in.Int(), ntl = in.Int(), group_nvars = in.Int(),
+              index = in.Int();
+    const int vtype = CCTK_VarTypeNumber(vtype_name.c_str());
+    if (vtype < 0 || CCTK_VarTypeSize(vtype) <= 0) {
+      fprintf(stderr, "Skipping %s of unsupported type %s\n", name.c_str(),
+              vtype_name.c_str());
+      vars[var] = -1;
+      return;
+    }
+    auto g = groups.find(group);
+    if (g == groups.end()) {
+      const int gt = gtype == 'G' ? CCTK_GF : gtype == 'A' ? CCTK_ARRAY
+                                                           : CCTK_SCALAR;
+      g = groups
+              .insert(std::make_pair(
+                  group, Mock_CreateGroup(StripImpl(group).c_str(), gt, vtype,
+                                          gdim, group_nvars, ntl)))
+              .first;
+    }
+    vars[var] = CCTK_FirstVarIndexI(g->second) + index;
+    Mock_SetVarName(vars[var], StripImpl(name).c_str());
+  }
+
+  /* the replayed index of a captured one, or -1 */
+  int Map(int var) const {
+    auto it = vars.find(var);
+    return it == vars.end() ? -1 : it->second;
+  }
+
+private:
+  std::map<std::string, int> groups;
+  std::map<int, int> vars;
+};
+
+std::vector<Block> ReadBlocks(Reader &in) {
+  std::vector<Block> blocks(in.Int());
+  for (Block &b : blocks) {
+    b.var = in.Int();
+    b.tl = in.Int();
+    b.bytes = in.Get<unsigned long long>();
+    b.data = in.Take(b.bytes);
+  }
+  return blocks;
+}
+
+Call ReadCall(Reader &in) {
+  Call c;
+  c.id = in.Get<unsigned long>();
+  c.bc_name = in.String();
+  c.iteration = in.Int();
+  c.time = in.Real();
+  c.delta_time = in.Real();
+  c.dim = in.Int();
+  const int dim = c.dim;
+  c.gsh = in.Ints(dim);
+  c.lsh = in.Ints(dim);
+  c.lbnd = in.Ints(dim);
+  c.ash = in.Ints(dim);
+  c.nghostzones = in.Ints(dim);
+  c.levfac = in.Ints(dim);
+  c.bbox = in.Ints(2 * dim);
+  c.symmetry = in.Ints(2 * std::min(dim, 3));
+  c.origin = in.Reals(dim);
+  c.delta = in.Reals(dim);
+  c.coords = in.Ints(4);
+  const int n = in.Int();
+  c.vars = in.Ints(n);
+  c.faces = in.Ints(n);
+  c.widths = in.Ints(n);
+  c.tables = in.Ints(n);
+  c.table_contents.resize(in.Int());
+  for (Table &t : c.table_contents) {
+    t.handle = in.Int();
+    t.keys.resize(in.Int());
+    for (Key &k : t.keys) {
+      k.name = in.String();
+      k.kind = in.Byte();
+      if (k.kind == 'i') {
+        k.ints = in.Ints(in.Int());
+      } else if (k.kind == 'r') {
+        k.reals = in.Reals(in.Int());
+      } else {
+        k.string = in.String();
+      }
+    }
+  }
+  c.before = ReadBlocks(in);
+  c.has_result = false;
+  c.retval = 0;
+  c.seconds = 0;
+  return c;
+}
+
+/* lapse-like profile of a uniform density star of radius 4, as in the
+   benchmark */
+double Profile(double r) {
+  const double M = 1, R = 4;
+  const double phi =
+      r < R ? -M * (3 * R * R - r * r) / (2 * R * R * R) : -M / r;
+  return 1 + phi;
+}
+
+template <typename T>
+void Differences(const T *a, const T *b, size_t n, double &max_abs,
+                 double &max_rel) {
+  for (size_t p = 0; p < n; p++) {
+    const double diff = fabs(double(a[p]) - double(b[p]));
+    max_abs = std::max(max_abs, diff);
+    if (diff > 0) {
+      max_rel = std::max(max_rel, diff / std::max(fabs(double(b[p])), 1e-300));
+    }
+  }
+}
+
+/* the mock component of one call, with its variables and coordinates */
+class Component {
+public:
+  Component(const Call &c, const Vars &vars, int coord_group) {
+    memset(&GH, 0, sizeof GH);
+    const int dim = c.dim;
+    gsh = c.gsh;
+    lsh = c.lsh;
+    lbnd = c.lbnd;
+    ash = c.ash;
+    nghostzones = c.nghostzones;
+    levfac = c.levfac;
+    bbox = c.bbox;
+    origin = c.origin;
+    delta = c.delta;
+    ubnd.resize(dim);
+    for (int d = 0; d < dim; d++) {
+      ubnd[d] = lbnd[d] + lsh[d] - 1;
+    }
+    GH.cctk_dim = dim;
+    GH.cctk_iteration = c.iteration;
+    GH.cctk_gsh = gsh.data();
+    GH.cctk_lsh = lsh.data();
+    GH.cctk_lbnd = lbnd.data();
+    GH.cctk_ubnd = ubnd.data();
+    GH.cctk_ash = ash.data();
+    GH.cctk_bbox = bbox.data();
+    GH.cctk_nghostzones = nghostzones.data();
+    GH.cctk_levfac = levfac.data();
+    GH.cctk_origin_space = origin.data();
+    GH.cctk_delta_space = delta.data();
+    GH.cctk_time = c.time;
+    GH.cctk_delta_time = c.delta_time;
+    GH.cctk_timefac = 1;
+    GH.cctk_convfac = 2;
+
+    npoints = 1;
+    for (int d = 0; d < dim; d++) {
+      npoints *= ash[d];
+    }
+    data.assign(CCTK_NumVars(), std::vector<void *>());
+    pointers.assign(CCTK_NumVars(), NULL);
+
+    /* the coordinates, for up to three dimensions */
+    const int c0 = CCTK_FirstVarIndexI(coord_group);
+    coord_r = c0 + 3;
+    for (int i = 0; i < 4; i++) {
+      Allocate(c0 + i);
+    }
+    CCTK_REAL *xyzr[4];
+    for (int i = 0; i < 4; i++) {
+      xyzr[i] = (CCTK_REAL *)data[c0 + i][0];
+    }
+    for (size_t p = 0; p < npoints; p++) {
+      size_t rest = p;
+      double r2 = 0;
+      for (int d = 0; d < 3; d++) {
+        double x = 0;
+        if (d < dim) {
+          const int i = rest % ash[d];
+          rest /= ash[d];
+          x = origin[d] + (lbnd[d] + i) * delta[d] / levfac[d];
+        }
+        xyzr[d][p] = x;
+        r2 += x * x;
+      }
+      xyzr[3][p] = sqrt(r2);
+    }
+
+    /* the variables, from the captured data if there is any */
+    for (int var : c.vars) {
+      Fill(c, vars, vars.Map(var));
+    }
+    for (const Block &b : c.before) {
+      Fill(c, vars, vars.Map(b.var));
+    }
+    for (const Table &t : c.table_contents) {
+      for (const Key &k : t.keys) {
+        if (strcasecmp(k.name.c_str(), "COPY_FROM")) {
+          continue;
+        }
+        /* the source and the variables following it */
+        const int from = k.kind == 'i'   ? vars.Map(k.ints.at(0))
+                         : k.kind == 's' ? CCTK_VarIndex(k.string.c_str())
+                                         : -1;
+        const int group = CCTK_GroupIndexFromVarI(from);
+        for (size_t v = 0; from >= 0 && v < c.vars.size(); v++) {
+          if (CCTK_GroupIndexFromVarI(from + v) == group) {
+            Fill(c, vars, from + v);
+          }
+        }
+      }
+    }
+    GH.data = pointers.data();
+  }
+
+  void *Data(int var, int tl) { return data[var][tl]; }
+
+  cGH GH;
+  size_t npoints;
+
+private:
+  void Allocate(int var) {
+    if (!data[var].empty()) {
+      return;
+    }
+    const int ntl = CCTK_DeclaredTimeLevelsVI(var);
+    const size_t size = npoints * CCTK_VarTypeSize(CCTK_VarTypeI(var));
+    for (int tl = 0; tl < ntl; tl++) {
+      storage.push_back(std::vector<char>(size + 64));
+      data[var].push_back(storage.back().data());
+    }
+    pointers[var] = data[var].data();
+  }
+
+  void Fill(const Call &c, const Vars &vars, int var) {
+    if (var < 0 || !data[var].empty()) {
+      return;
+    }
+    Allocate(var);
+    const int vtype = CCTK_VarTypeI(var);
+    const size_t size = npoints * CCTK_VarTypeSize(vtype);
+    const CCTK_REAL *r = (const CCTK_REAL *)data[coord_r][0];
+    for (size_t tl = 0; tl < data[var].size(); tl++) {
+      bool captured = false;
+      for (const Block &b : c.before) {
+        if (vars.Map(b.var) == var && b.tl == int(tl) && b.bytes == size) {
+          memcpy(data[var][tl], b.data, size);
+          captured = true;
+        }
+      }
+      if (captured) {
+        continue;
+      }
+      const double amplitude = 1 + 0.01 * (var % 8) - 0.01 * tl;
+      for (size_t p = 0; p < npoints; p++) {
+        const double value = amplitude * Profile(r[p]);
+        switch (vtype) {
+        case CCTK_VARIABLE_REAL4:
+          ((CCTK_REAL4 *)data[var][tl])[p] = CCTK_REAL4(value);
+          break;
+        case CCTK_VARIABLE_REAL:
+        case CCTK_VARIABLE_REAL8:
+          ((CCTK_REAL8 *)data[var][tl])[p] = CCTK_REAL8(value);
+          break;
+        default:
+          break;
+        }
+      }
+    }
+  }
+
+  int coord_r;
+  std::vector<int> gsh, lsh, lbnd, ubnd, ash, nghostzones, levfac, bbox;
+  std::vector<double> origin, delta;
+  std::vector<std::vector<char>> storage;
+  std::vector<std::vector<void *>> data;
+  std::vector<void **> pointers;
+};
+
+/* the captured tables, with COPY_FROM indices mapped to the replay */
+std::map<int, int> MakeTables(const Call &c, const Vars &vars) {
+  std::map<int, int> tables;
+  for (const Table &t : c.table_contents) {
+    const int table = Util_TableCreate(UTIL_TABLE_FLAGS_DEFAULT);
+    for (const Key &k : t.keys) {
+      if (k.kind == 'i') {
+        std::vector<CCTK_INT> values(k.ints.begin(), k.ints.end());
+        if (!strcasecmp(k.name.c_str(), "COPY_FROM") && values.size() == 1) {
+          values[0] = vars.Map(values[0]);
+        }
+        Util_TableSetIntArray(table, values.size(), values.data(),
+                              k.name.c_str());
+      } else if (k.kind == 'r') {
+        std::vector<CCTK_REAL> values(k.reals.begin(), k.reals.end());
+        Util_TableSetRealArray(table, values.size(), values.data(),
+                               k.name.c_str());
+      } else {
+        Util_TableSetString(table, k.string.c_str(), k.name.c_str());
+      }
+    }
+    tables[t.handle] = table;
+  }
+  return tables;
+}
+
+struct Summary {
+  long calls, skipped, failed;
+  double captured_seconds, seconds;
+  double max_abs, max_rel;
+};
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const Options o = ParseOptions(argc, argv);
+
+  Reader in(o.file);
+  if (strcmp(in.Take(sizeof BND_CAPTURE_MAGIC), BND_CAPTURE_MAGIC) != 0) {
+    fprintf(stderr, "'%s' is not a boundary capture file\n", o.file.c_str());
+    return 1;
+  }
+  const int version = in.Int(), marker = in.Int(), proc = in.Int();
+  if (version != BND_CAPTURE_VERSION || marker != 0x01020304) {
+    fprintf(stderr,
+            "'%s' has version %d or byte order of another machine; "
+            "expected version %d\n",
+            o.file.c_str(), version, BND_CAPTURE_VERSION);
+    return 1;
+  }
+
+  const int coord_group = Mock_CreateGroup(
+      "replay_coordinates", CCTK_GF, CCTK_VARIABLE_REAL, 3, 4, 1);
+  const int c0 = CCTK_FirstVarIndexI(coord_group);
+  Mock_SetCoordinates(c0, c0 + 1, c0 + 2, c0 + 3);
+
+  Vars vars;
+  std::vector<Call> calls;
+  std::map<unsigned long, size_t> call_index;
+  while (!in.AtEnd()) {
+    const char tag = in.Byte();
+    if (tag == 'V') {
+      vars.Describe(in);
+    } else if (tag == 'C') {
+      calls.push_back(ReadCall(in));
+      call_index[calls.back().id] = calls.size() - 1;
+    } else if (tag == 'R') {
+      const unsigned long id = in.Get<unsigned long>();
+      const int retval = in.Int();
+      const double seconds = in.Real();
+      std::vector<Block> after = ReadBlocks(in);
+      auto it = call_index.find(id);
+      if (it != call_index.end()) {
+        Call &c = calls[it->second];
+        c.has_result = true;
+        c.retval = retval;
+        c.seconds = seconds;
+        c.after = after;
+      }
+    } else {
+      fprintf(stderr, "Unknown record '%c' in '%s'\n", tag, o.file.c_str());
+      return 1;
+    }
+  }
+  printf("Replaying %zu boundary calls of process %d with the %s kernels\n",
+         calls.size(), proc, o.reference ? "reference" : "thorn");
+
+  std::map<std::string, Summary> summaries;
+  int failures = 0;
+  for (const Call &c : calls) {
+    std::string bc_name = c.bc_name;
+    std::transform(bc_name.begin(), bc_name.end(), bc_name.begin(), ::tolower);
+    Summary &s = summaries[bc_name];
+    const ReplayBC *bc = NULL;
+    for (const ReplayBC &b : replay_bcs) {
+      if (bc_name == b.name) {
+        bc = &b;
+      }
+    }
+    const bool selected =
+        std::find(o.bcs.begin(), o.bcs.end(), "all") != o.bcs.end() ||
+        std::find(o.bcs.begin(), o.bcs.end(), bc_name) != o.bcs.end();
+    std::vector<CCTK_INT> var_indices;
+    for (int var : c.vars) {
+      var_indices.push_back(vars.Map(var));
+    }
+    if (!selected || !bc || c.dim > 3 ||
+        std::count(var_indices.begin(), var_indices.end(), -1) > 0) {
+      s.skipped++;
+      continue;
+    }
+
+    Component comp(c, vars, coord_group);
+    /* the captured coordinates if the call has them */
+    int coords[4];
+    for (int i = 0; i < 4; i++) {
+      coords[i] = c0 + i;
+      for (const Block &b : c.before) {
+        if (b.var == c.coords[i] && vars.Map(b.var) >= 0) {
+          coords[i] = vars.Map(b.var);
+        }
+      }
+    }
+    Mock_SetCoordinates(coords[0], coords[1], coords[2], coords[3]);
+    std::vector<CCTK_INT> symmetry(c.symmetry.begin(), c.symmetry.end());
+    Mock_SetSymmetryHandles(symmetry.data(), symmetry.size());
+    std::map<int, int> table_map = MakeTables(c, vars);
+    std::vector<CCTK_INT> faces(c.faces.begin(), c.faces.end()),
+        widths(c.widths.begin(), c.widths.end()), tables;
+    for (int t : c.tables) {
+      tables.push_back(t >= 0 ? table_map.at(t) : t);
+    }
+
+    /* the current time level of the variables, to start every
+       repetition from the same input */
+    std::vector<std::vector<char>> input;
+    for (CCTK_INT var : var_indices) {
+      const char *p = (const char *)comp.Data(var, 0);
+      input.push_back(std::vector<char>(
+          p, p + comp.npoints * CCTK_VarTypeSize(CCTK_VarTypeI(var))));
+    }
+    const boundary_function func = o.reference ? bc->ref : bc->func;
+    double seconds = 0;
+    CCTK_INT retval = 0;
+    for (int r = 0; r < o.repeat; r++) {
+      for (size_t v = 0; v < var_indices.size(); v++) {
+        memcpy(comp.Data(var_indices[v], 0), input[v].data(), input[v].size());
+      }
+      const auto start = std::chrono::steady_clock::now();
+      retval = func(&comp.GH, var_indices.size(), var_indices.data(),
+                    faces.data(), widths.data(), tables.data());
+      const double elapsed = std::chrono::duration<double>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+      seconds = r == 0 ? elapsed : std::min(seconds, elapsed);
+    }
+    for (const auto &t : table_map) {
+      Util_TableDestroy(t.second);
+    }
+
+    double max_abs = 0, max_rel = 0;
+    for (const Block &b : c.after) {
+      const int var = vars.Map(b.var);
+      const int vtype = CCTK_VarTypeI(var);
+      if (b.bytes != comp.npoints * CCTK_VarTypeSize(vtype)) {
+        continue;
+      }
+      const void *got = comp.Data(var, b.tl);
+      if (vtype == CCTK_VARIABLE_REAL4) {
+        Differences((const CCTK_REAL4 *)got, (const CCTK_REAL4 *)b.data,
+                    comp.npoints, max_abs, max_rel);
+      } else if (vtype == CCTK_VARIABLE_REAL || vtype == CCTK_VARIABLE_REAL8) {
+        Differences((const CCTK_REAL8 *)got, (const CCTK_REAL8 *)b.data,
+                    comp.npoints, max_abs, max_rel);
+      } else if (memcmp(got, b.data, b.bytes) != 0) {
+        max_rel = std::max(max_rel, 1.0);
+      }
+    }
+    const bool failed = (c.has_result && (retval < 0) != (c.retval < 0)) ||
+                        max_rel > o.tolerance;
+    s.calls++;
+    s.failed += failed;
+    s.captured_seconds += c.seconds;
+    s.seconds += seconds;
+    s.max_abs = std::max(s.max_abs, max_abs);
+    s.max_rel = std::max(s.max_rel, max_rel);
+    failures += failed;
+    if (o.verbose || failed) {
+      printf("call %lu: %s on %zu vars, iteration %d, lsh", c.id,
+             c.bc_name.c_str(), c.vars.size(), c.iteration);
+      for (int d = 0; d < c.dim; d++) {
+        printf("%c%d", d ? 'x' : ' ', c.lsh[d]);
+      }
+      printf(": %.2f us (captured %.2f us), retval %d (captured %d), "
+             "max rel diff %.3g%s\n",
+             seconds * 1e6, c.seconds * 1e6, int(retval), c.retval, max_rel,
+             failed ? "  FAILED" : "");
+    }
+  }
+
+  printf("%-10s %8s %8s %14s %14s %8s %10s %10s\n", "bc", "calls", "skipped",
+         "captured us", "replayed us", "ratio", "max abs", "max rel");
+  for (const auto &kv : summaries) {
+    const Summary &s = kv.second;
+    printf("%-10s %8ld %8ld %14.1f %14.1f %8.2f %10.3g %10.3g\n",
+           kv.first.c_str(), s.calls, s.skipped, s.captured_seconds * 1e6,
+           s.seconds * 1e6, s.seconds > 0 ? s.captured_seconds / s.seconds : 0,
+           s.max_abs, s.max_rel);
+  }
+  printf("%d mismatch%s\n", failures, failures == 1 ? "" : "es");
+  return failures != 0;
+}
@@ -11,6 +11,8 @@
 #ifndef _BOUNDARY2_H_
 #define _BOUNDARY2_H_
 
+#include <stddef.h>
+
 #include "PreSync.h"
 
 #ifdef __cplusplus
@@ -21,6 +23,134 @@ extern "C" {
 void BndSanityCheckWidths2(const cGH *GH, CCTK_INT varindex, CCTK_INT dim,
                           const CCTK_INT *boundary_widths, const char *bcname);
 
+/* whether two variables can be handled by one call of a kernel */
+int BndCanBatchVars2(const cGH *GH, CCTK_INT var1, CCTK_INT var2);
+
+/* decide whether a kernel loop over npoints points should use threads */
+int BndUseThreads2(CCTK_INT npoints);
+
+/* the rows along x of the boundary zones of the lower and upper face of
+   one direction for a run of variables, in (variable, face, row) order;
+   ny and nz are the rows per plane and the planes of the zone of each
+   face, both 0 if the face is skipped */
+typedef struct {
+  int num_vars;
+  int ny[2], nz[2];
+} BndRows2;
+
+/* one of these rows: the offset of the variable in the run, whether it
+   is on the upper face, and its position within the boundary zone */
+typedef struct {
+  int var, upper, j, k;
+} BndRow2;
+
+/* set up the rows of both faces of a direction from the extents of their
+   boundary zones, NULL for a face which is skipped */
+BndRows2 BndFaceRows2(int num_vars, const int *lower_extent,
+                      const int *upper_extent);
+
+/* the share of the rows for the calling thread of a parallel region if
+   threaded, else all of them: the number of its rows is returned and row
+   is set to the first one */
+int BndRowsShare2(const BndRows2 *rows, int threaded, BndRow2 *row);
+
+/* the number of rows left in the plane of a row */
+#define BND_PLANE_ROWS2(rows, row) ((rows).ny[(row).upper] - (row).j)
+
+/* step from a row to the first row of the next plane, without any
+   division */
+#define BND_NEXT_PLANE2(rows, row)                                             \
+  do {                                                                         \
+    (row).j = 0;                                                               \
+    if (++(row).k == (rows).nz[(row).upper]) {                                 \
+      (row).k = 0;                                                             \
+      if ((row).upper || !(rows).nz[1]) {                                      \
+        (row).upper = !(rows).nz[0];                                           \
+        (row).var++;                                                           \
+      } else {                                                                 \
+        (row).upper = 1;                                                       \
+      }                                                                        \
+    }                                                                          \
+  } while (0)
+
+/* expand MACRO(size) with size a constant for the common sizes of the
+   variable types, so that a memcpy of one element becomes a plain load
+   and store; other sizes use size itself */
+#define BND_SWITCH_SIZE2(size, MACRO)                                          \
+  switch (size) {                                                              \
+  case 1:                                                                      \
+    MACRO(1);                                                                  \
+    break;                                                                     \
+  case 2:                                                                      \
+    MACRO(2);                                                                  \
+    break;                                                                     \
+  case 4:                                                                      \
+    MACRO(4);                                                                  \
+    break;                                                                     \
+  case 8:                                                                      \
+    MACRO(8);                                                                  \
+    break;                                                                     \
+  case 16:                                                                     \
+    MACRO(16);                                                                 \
+    break;                                                                     \
+  default:                                                                     \
+    MACRO(size);                                                               \
+    break;                                                                     \
+  }
+
+/* run statement in a parallel region if threaded and directly otherwise,
+   so that a serial call does not pay for entering a region */
+#define BND_PARALLEL_IF2(threaded, statement)                                  \
+  if (threaded) {                                                              \
+    _Pragma("omp parallel") statement;                                         \
+  } else {                                                                     \
+    statement;                                                                 \
+  }
+
+/* record the modelled memory traffic and flops of a kernel loop over
+   npoints points for the timer of the BC call now running, if any */
+void BndCountWork2(CCTK_INT npoints, int bytes_per_point, int flops_per_point);
+
+/* record that a kernel loop of the BC call now running, if any, is
+   spread over nthreads threads */
+void BndCountThreads2(int nthreads);
+
+/* true while the calling thread runs tasks of the boundary task pool */
+int BndInTaskPool2(void);
+
+/* register a physical BC for the phase before (1) or after (0) the sync */
+CCTK_INT Bdry2_Boundary_RegisterPhysicalBCPhase(const cGH *cctkGH,
+                                                boundary_function func,
+                                                const char *bc_name,
+                                                CCTK_INT before);
+
+/* register a physical BC provided as a pointwise functor, see
+   Boundary2_Pointwise.hh */
+CCTK_INT Bdry2_Boundary_RegisterPointwiseBC(const cGH *cctkGH,
+                                            boundary_function func,
+                                            const char *bc_name,
+                                            CCTK_INT pure,
+                                            CCTK_INT points_read);
+
+/* the boundary zones of a variable as seen by a pointwise BC; unused
+   dimensions have one point and no boundary */
+typedef struct {
+  int dim, vtype;
+  int lsh[3];
+  CCTK_INT width[6];
+  int doBC[6];
+  ptrdiff_t stride[3];
+  CCTK_REAL delta[3];
+  /* x, y, z and r, or NULL if the BC does not need coordinates */
+  const CCTK_REAL *xyzr[4];
+} BndPointwiseGrid;
+
+/* set up the boundary zones a pointwise BC updates for one variable */
+int BndPointwiseGrid2(const cGH *GH, CCTK_INT var, CCTK_INT faces,
+                      CCTK_INT width, CCTK_INT table, int interior_points,
+                      int past_timelevels, int needs_coordinates,
+                      BndPointwiseGrid *grid);
+
 /* prototype for routine registered as providing 'None' boundary condition */
 CCTK_INT Bndry_None(const cGH *cctkGH, CCTK_INT num_vars, CCTK_INT *var_indices,
                  CCTK_INT *faces, CCTK_INT *widths,
@@ -56,6 +186,16 @@ CCTK_INT Bndry_Flat(const cGH *cctkGH, const CCTK_INT num_vars, const CCTK_INT *
                  const CCTK_INT *faces, const CCTK_INT *widths,
                  const CCTK_INT *table_handles);
 
+/* prototype for routine registered as providing 'Extrapolate' boundary condition */
+CCTK_INT Bndry_Extrapolate(const cGH *cctkGH, CCTK_INT num_vars, CCTK_INT *var_indices,
+                        CCTK_INT *faces, CCTK_INT *widths,
+                        CCTK_INT *table_handles);
+
+/* prototype for routine registered as providing 'Outflow' boundary condition */
+CCTK_INT Bndry_Outflow(const cGH *cctkGH, CCTK_INT num_vars, CCTK_INT *var_indices,
+                    CCTK_INT *faces, CCTK_INT *widths,
+                    CCTK_INT *table_handles);
+
 #ifdef __cplusplus
 }
 #endif
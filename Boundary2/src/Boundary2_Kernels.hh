@@ -0,0 +1,274 @@
+/*@@
+  @file      Boundary2_Kernels.hh
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Inline, type-templated versions of the pointwise updates of
+             the Scalar, Flat, Static, Radiation and Robin boundary
+             conditions, for thorns which apply a boundary condition in
+             the loop that computed the data instead of a separate pass
+             afterwards.
+
+             The functions compute exactly what the registered boundary
+             conditions compute for one point or one row of points, and
+             the parameter structs read the same table keys with the
+             same defaults.  The caller owns the traversal: it decides
+             which points are boundary points (outer faces with
+             cctk_bbox set and no symmetry) and visits the faces in the
+             order the registered conditions use (x, y, then z; for
+             Radiation, points of a face from the inside out).
+  @enddesc
+  @version   $Header$
+@@*/
+
+#ifndef _BOUNDARY2_KERNELS_HH_
+#define _BOUNDARY2_KERNELS_HH_
+
+#ifndef __cplusplus
+#error "Boundary2_Kernels.hh can only be used from C++"
+#endif
+
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+
+#include "cctk.h"
+#include "util_ErrorCodes.h"
+#include "util_Table.h"
+
+namespace Boundary2 {
+namespace Kernels {
+
+/** Distance in array elements between two points */
+typedef std::ptrdiff_t Offset;
+
+/* ---------------------------------------------------------------- */
+/* Scalar: boundary points are set to SCALAR (default 0)            */
+
+struct ScalarParams {
+  CCTK_REAL scalar;
+
+  ScalarParams() : scalar(0) {}
+  /** Read SCALAR from a table as the registered condition does */
+  explicit ScalarParams(CCTK_INT table) : scalar(0) {
+    Util_TableGetReal(table, &scalar, "SCALAR");
+  }
+};
+
+template <typename T>
+inline void ScalarPoint(const ScalarParams &p, T *to) {
+  *to = T(p.scalar);
+}
+
+/** Set n points, stride elements apart, starting at to */
+template <typename T>
+inline void ScalarRow(const ScalarParams &p, T *to, Offset stride, int n) {
+  const T value = T(p.scalar);
+  for (int i = 0; i < n; i++) {
+    to[i * stride] = value;
+  }
+}
+
+/* ---------------------------------------------------------------- */
+/* Flat: boundary points copy the first interior point along the    */
+/* normal of their face                                             */
+
+/** Copy the interior point from to the boundary point to */
+template <typename T> inline void FlatPoint(T *to, const T *from) {
+  *to = *from;
+}
+
+/**
+ * Copy n points: to[i * to_stride] = from[i * from_stride]. A row
+ * along the normal of a face has from_stride 0, a row along the face
+ * has equal strides.
+ */
+template <typename T>
+inline void FlatRow(T *to, Offset to_stride, const T *from,
+                    Offset from_stride, int n) {
+  for (int i = 0; i < n; i++) {
+    to[i * to_stride] = from[i * from_stride];
+  }
+}
+
+/* ---------------------------------------------------------------- */
+/* Static: boundary points keep the value of the previous time      */
+/* level                                                            */
+
+template <typename T> inline void StaticPoint(T *to, const T *previous) {
+  *to = *previous;
+}
+
+/** Copy n points, stride elements apart, from the previous time level */
+template <typename T>
+inline void StaticRow(T *to, const T *previous, Offset stride, int n) {
+  for (int i = 0; i < n; i++) {
+    to[i * stride] = previous[i * stride];
+  }
+}
+
+/* ---------------------------------------------------------------- */
+/* Radiation: outgoing radial wave with asymptotic value LIMIT      */
+/* (default 0) and speed SPEED (default 1)                          */
+
+/**
+ * The Courant factors of the radiation condition on one face. The
+ * registered condition mirrors its stencil on upper faces; here both
+ * faces share one formula, with rho and the spacing negated on upper
+ * faces, which gives bit-identical results.
+ */
+struct RadiativeFace {
+  CCTK_REAL var0, dtv, dtvh, dtvvar0, rho, dx;
+  int radpower;
+  /** +1 on lower faces, -1 on upper faces */
+  int sign;
+
+  /**
+   * face is the face index (0 for lower x, 1 for upper x, ...). radpower
+   * is Boundary2::radpower, which RadPower() returns.
+   */
+  RadiativeFace(const cGH *cctkGH, int face, CCTK_REAL limit, CCTK_REAL speed,
+                int radpower_)
+      : var0(limit), dtv(speed * cctkGH->cctk_delta_time), dtvh(0.5 * dtv),
+        dtvvar0(dtv * var0), radpower(radpower_), sign(face & 1 ? -1 : 1) {
+    const int d = face / 2;
+    const CCTK_REAL dxyz =
+        cctkGH->cctk_delta_space[d] / cctkGH->cctk_levfac[d];
+    rho = sign * (dtv / dxyz);
+    dx = sign * dxyz;
+  }
+};
+
+/** Read LIMIT and SPEED from a table as the registered condition does */
+inline void RadiativeFromTable(CCTK_INT table, CCTK_REAL &limit,
+                               CCTK_REAL &speed) {
+  limit = 0;
+  speed = 1;
+  if (Util_TableGetReal(table, &limit, "LIMIT") != UTIL_ERROR_BAD_HANDLE) {
+    Util_TableGetReal(table, &speed, "SPEED");
+  }
+}
+
+/** The radpower parameter of Boundary2 */
+inline int RadPower() {
+  const void *value = CCTK_ParameterGet("radpower", "Boundary2", NULL);
+  return value ? int(*(const CCTK_INT *)value) : -1;
+}
+
+/**
+ * New value of the boundary point at to. from is the same point on the
+ * previous time level, r the radius and xyz the coordinate along the
+ * normal of the face at that point, and stride the distance of two
+ * points along the normal. The two next points further inside must
+ * already hold their new values.
+ */
+template <typename T>
+inline T RadiativePoint(const RadiativeFace &f, const T *to, const T *from,
+                        const CCTK_REAL *r, const CCTK_REAL *xyz,
+                        Offset stride) {
+  const Offset i1 = f.sign * stride, i2 = 2 * f.sign * stride;
+  const CCTK_REAL r0_inv = 1 / r[0], r1_inv = 1 / r[i1];
+  CCTK_REAL dtvvar0H = f.dtvvar0;
+
+  if (f.radpower > 0) {
+    /* summed in the order of the registered condition on each face */
+    const CCTK_REAL dvar =
+        f.sign > 0 ? to[i2] - to[i1] + from[i2] - from[i1]
+                   : -(to[i1] - to[i2] + from[i1] - from[i2]);
+    CCTK_REAL H;
+
+    H = 0.25 * f.radpower * f.dx *
+        (xyz[0] * (r0_inv * r0_inv) + xyz[i1] * (r1_inv * r1_inv));
+    H = (1 + H) / (1 - H);
+    H *= f.dtv * (0.25 * (to[i1] + to[i2] + from[i1] + from[i2]) - f.var0) +
+         0.5 * (r[i1] * (to[i1] - from[i1]) + r[i2] * (to[i2] - from[i2])) +
+         0.25 * dvar * f.rho *
+             ((r[i1] * r[i1]) / xyz[i1] + (r[i2] * r[i2]) / xyz[i2]);
+    dtvvar0H = f.dtvvar0 + H;
+  }
+
+  return T((dtvvar0H * (xyz[0] * (r0_inv * r0_inv) +
+                        xyz[i1] * (r1_inv * r1_inv)) -
+            to[i1] * (f.rho + xyz[i1] * r1_inv * (1 + f.dtvh * r1_inv)) +
+            from[0] * (f.rho + xyz[0] * r0_inv * (1 - f.dtvh * r0_inv)) -
+            from[i1] * (f.rho - xyz[i1] * r1_inv * (1 - f.dtvh * r1_inv))) /
+           (-f.rho + xyz[0] * r0_inv * (1 + f.dtvh * r0_inv)));
+}
+
+/**
+ * Update n points along the face, row_stride elements apart, which are
+ * at the same depth of the boundary.
+ */
+template <typename T>
+inline void RadiativeRow(const RadiativeFace &f, T *to, const T *from,
+                         const CCTK_REAL *r, const CCTK_REAL *xyz,
+                         Offset stride, Offset row_stride, int n) {
+  for (int i = 0; i < n; i++) {
+    const Offset o = i * row_stride;
+    to[o] = RadiativePoint(f, to + o, from + o, r + o, xyz + o, stride);
+  }
+}
+
+/* ---------------------------------------------------------------- */
+/* Robin: decay towards FINF (default 0) as 1/r^DECAY_POWER         */
+/* (default 1)                                                      */
+
+struct RobinParams {
+  CCTK_REAL finf;
+  CCTK_INT npow;
+
+  RobinParams() : finf(0), npow(1) {}
+  /** Read FINF and DECAY_POWER from a table as the registered condition
+      does */
+  explicit RobinParams(CCTK_INT table) : finf(0), npow(1) {
+    if (Util_TableGetReal(table, &finf, "FINF") != UTIL_ERROR_BAD_HANDLE) {
+      Util_TableGetInt(table, &npow, "DECAY_POWER");
+    }
+  }
+};
+
+/**
+ * New value of a boundary point from its inner neighbour inner.
+ * u_dst and u_src are the distances of the two points from the origin
+ * projected on the direction between them (the absolute coordinate for
+ * a neighbour along one axis), r_dst and r_src their radii and distance
+ * the distance between them.
+ */
+template <typename T>
+inline T RobinValue(const RobinParams &p, T inner, double u_dst, double u_src,
+                    double r_dst, double r_src, double distance) {
+  const double aux = double(p.npow) * distance * (u_src + u_dst) /
+                     ((r_src + r_dst) * (r_src + r_dst));
+  return T((2 * aux * p.finf + inner * (1 - aux)) / (1 + aux));
+}
+
+/**
+ * Update data[dst] from its inner neighbour data[src], which is
+ * (dx, dy, dz) points away and distance apart. x, y, z and r are the
+ * coordinates of the grid.
+ */
+template <typename T>
+inline void RobinPoint(const RobinParams &p, T *data, Offset dst, Offset src,
+                       int dx, int dy, int dz, const CCTK_REAL *x,
+                       const CCTK_REAL *y, const CCTK_REAL *z,
+                       const CCTK_REAL *r, double distance) {
+  double u_src, u_dst;
+
+  if (std::abs(dx) + std::abs(dy) + std::abs(dz) == 1) {
+    u_dst = std::fabs(double(dx ? x[dst] : (dy ? y[dst] : z[dst])));
+    u_src = std::fabs(double(dx ? x[src] : (dy ? y[src] : z[src])));
+  } else {
+    u_dst = std::sqrt((dx * x[dst]) * (dx * x[dst]) +
+                      (dy * y[dst]) * (dy * y[dst]) +
+                      (dz * z[dst]) * (dz * z[dst]));
+    u_src = std::sqrt((dx * x[src]) * (dx * x[src]) +
+                      (dy * y[src]) * (dy * y[src]) +
+                      (dz * z[src]) * (dz * z[src]));
+  }
+  data[dst] = RobinValue(p, data[src], u_dst, u_src, r[dst], r[src], distance);
+}
+
+} // namespace Kernels
+} // namespace Boundary2
+
+#endif /* _BOUNDARY2_KERNELS_HH_ */
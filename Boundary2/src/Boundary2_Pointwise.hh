@@ -0,0 +1,310 @@
+/*@@
+  @file      Boundary2_Pointwise.hh
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Registration of physical boundary conditions given as a
+             pointwise C++ functor.  A thorn only writes what happens at
+             one boundary point; the boundary function generated here
+             reads the width, faces and symmetries, walks the boundary
+             zones in the order the boundary conditions of this thorn
+             use, threads and vectorizes the loops, and handles whole
+             runs of variables in one call.
+
+             A functor looks like
+
+               struct MyBC : Boundary2::PointwiseTraits {
+                 static const int interior_points = 1;
+                 CCTK_REAL value;
+                 MyBC(const cGH *cctkGH, CCTK_INT table);
+                 template <typename T>
+                 T operator()(const Boundary2::Point<T> &p) const;
+               };
+
+             and is registered from a scheduled routine with
+
+               Boundary2::RegisterPointwiseBC<MyBC>(cctkGH, "MyBC");
+
+             by a thorn whose interface.ccl uses the aliased function
+             Boundary_RegisterPointwiseBC.
+
+             The functor is constructed for every variable of a BC call
+             from the table the variable was selected with, and returns the
+             new value of the point p.  Its traits (see PointwiseTraits)
+             tell the engine what the functor reads.
+  @enddesc
+  @version   $Header$
+@@*/
+
+#ifndef _BOUNDARY2_POINTWISE_HH_
+#define _BOUNDARY2_POINTWISE_HH_
+
+#ifndef __cplusplus
+#error "Boundary2_Pointwise.hh can only be used from C++"
+#endif
+
+#include <cstddef>
+#include <vector>
+
+#include "cctk.h"
+#include "cctk_Functions.h"
+#include "Boundary2.h"
+
+namespace Boundary2 {
+
+/**
+ * Default traits of a pointwise functor, which derives from this struct
+ * and redeclares the members it changes.
+ */
+struct PointwiseTraits {
+  /** whether the functor reads coordinates (Point::coord, radius) */
+  static const bool needs_coordinates = false;
+  /** how many past time levels the functor reads (Point::past) */
+  static const int past_timelevels = 0;
+  /** how many points inside the boundary point along the normal the
+      functor reads (Point::inner); boundary points are updated from
+      the inside out, so these may be boundary points already updated */
+  static const int interior_points = 0;
+  /** whether the functor reads nothing but the variable it is applied
+      to and the grid, so that the engine may apply it concurrently
+      with other BCs and before the ghost zone exchange */
+  static const bool pure = true;
+  /** whether the points of a row may be computed as one vector, which
+      needs a functor without side effects, e.g. on its own members */
+  static const bool vectorizable = true;
+};
+
+/**
+ * A boundary point as seen by a pointwise functor
+ */
+template <typename T> struct Point {
+  /** data[l] is time level l of the variable */
+  const T *const *data;
+  /** x, y, z and r, if the functor needs coordinates */
+  const CCTK_REAL *const *xyzr;
+  /** linear index of the point */
+  std::ptrdiff_t index;
+  /** index offset of the next point inside along the normal */
+  std::ptrdiff_t inward;
+  /** face index (0 for lower x, 1 for upper x, ...) */
+  int face;
+  /** distance from the outer edge of the grid, 0 for the outermost
+      points */
+  int depth;
+  /** grid spacing along the normal */
+  CCTK_REAL spacing;
+
+  /** the point k points further inside on the current time level */
+  T inner(int k) const { return data[0][index + k * inward]; }
+  /** the point k points further inside on past time level l > 0 */
+  T past(int l, int k = 0) const { return data[l][index + k * inward]; }
+  /** coordinate d of the point k points further inside */
+  CCTK_REAL coord(int d, int k = 0) const {
+    return xyzr[d][index + k * inward];
+  }
+  /** radius of the point k points further inside */
+  CCTK_REAL radius(int k = 0) const { return xyzr[3][index + k * inward]; }
+};
+
+/**
+ * Apply the functors fs[v] to the variables vars[v] of one shape,
+ * described by g. Directions are handled one after another so that
+ * edges and corners come out as with the other BCs of this thorn;
+ * within a direction the rows of both faces of all variables are
+ * distributed over threads, without entering a parallel region when
+ * there are too few points. Rows run along x on y and z faces, where
+ * they are contiguous and the inner loop vectorizes, and along y on x
+ * faces, so that no row is just one point long; those are applied a
+ * few points at a time, with all depths of a piece before the next.
+ */
+template <class F, typename T>
+void ApplyPointwise(const cGH *cctkGH, const BndPointwiseGrid &g,
+                    const CCTK_INT *vars, const F *fs, int num_vars) {
+  const int nlevels = F::past_timelevels + 1;
+  const int x_piece = 8;
+
+  for (int d = 0; d < 3; d++) {
+    const int nx = d == 0 ? g.lsh[1] : g.lsh[0];
+    const int nrows = g.lsh[0] * g.lsh[1] * g.lsh[2] / (g.lsh[d] * nx);
+    /* the faces overlap if one reads points the other writes */
+    const int split =
+        g.lsh[d] < g.width[2 * d] + g.width[2 * d + 1] + F::interior_points;
+
+    for (int pass = 0; pass <= split; pass++) {
+      const int nlower = g.doBC[2 * d] && !(split && pass == 1) ? nrows : 0;
+      const int nupper =
+          g.doBC[2 * d + 1] && !(split && pass == 0) ? nrows : 0;
+      const int nitems = num_vars * (nlower + nupper);
+      const CCTK_INT npoints =
+          num_vars * nx *
+          (nlower * g.width[2 * d] + nupper * g.width[2 * d + 1]);
+
+      BndCountWork2(npoints,
+                    (1 + F::interior_points + F::past_timelevels) *
+                            sizeof(T) +
+                        (F::needs_coordinates ? 4 * sizeof(CCTK_REAL) : 0),
+                    0);
+
+      const auto apply_row = [&](int item) {
+        const int v = item / (nlower + nupper);
+        int row = item % (nlower + nupper);
+        const int face = row < nlower ? 2 * d : 2 * d + 1;
+        const T *data[nlevels];
+        T *to = (T *)cctkGH->data[vars[v]][0];
+        int ijk[3] = {0, 0, 0};
+
+        if (face & 1) {
+          row -= nlower;
+        }
+        ijk[d == 2 ? 1 : 2] = row;
+        for (int l = 0; l < nlevels; l++) {
+          data[l] = (const T *)cctkGH->data[vars[v]][l];
+        }
+
+        Point<T> p;
+        p.data = data;
+        p.xyzr = g.xyzr;
+        p.face = face;
+        p.inward = face & 1 ? -g.stride[d] : g.stride[d];
+        p.spacing = g.delta[d];
+
+        /* from the inside out, so that interior reads see updated
+           boundary points */
+        if (d == 0) {
+          /* every point of a row of an x face is a cache line of its
+             own, and a whole row of them may not stay in the cache
+             from one depth to the next, so the rows are done in
+             pieces */
+          for (int j0 = 0; j0 < nx; j0 += x_piece) {
+            const int j1 = j0 + x_piece < nx ? j0 + x_piece : nx;
+
+            for (int n = g.width[face] - 1; n >= 0; n--) {
+              const std::ptrdiff_t start =
+                  (face & 1 ? g.lsh[0] - 1 - n : n) + row * g.stride[2];
+              p.depth = n;
+              for (int j = j0; j < j1; j++) {
+                p.index = start + j * g.stride[1];
+                to[p.index] = fs[v](p);
+              }
+            }
+          }
+          return;
+        }
+        for (int n = g.width[face] - 1; n >= 0; n--) {
+          ijk[d] = face & 1 ? g.lsh[d] - 1 - n : n;
+          const std::ptrdiff_t start =
+              ijk[1] * g.stride[1] + ijk[2] * g.stride[2];
+          p.depth = n;
+          if (F::vectorizable) {
+#pragma omp simd
+            for (int i = 0; i < nx; i++) {
+              Point<T> q = p;
+              q.index = start + i;
+              to[q.index] = fs[v](q);
+            }
+          } else {
+            for (int i = 0; i < nx; i++) {
+              p.index = start + i;
+              to[p.index] = fs[v](p);
+            }
+          }
+        }
+      };
+
+      if (BndUseThreads2(npoints)) {
+#pragma omp parallel for schedule(static)
+        for (int item = 0; item < nitems; item++) {
+          apply_row(item);
+        }
+      } else {
+        for (int item = 0; item < nitems; item++) {
+          apply_row(item);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * The boundary function registered for the functor F. Variables of
+ * one shape selected with the same faces and width are handled in one
+ * loop, each with the functor constructed from its own table.
+ */
+template <class F>
+CCTK_INT PointwiseBC(const cGH *cctkGH, CCTK_INT num_vars, CCTK_INT *vars,
+                     CCTK_INT *faces, CCTK_INT *widths, CCTK_INT *tables) {
+  CCTK_INT retval = 0;
+  int i, j;
+
+  for (i = 0; i < num_vars; i += j) {
+    j = 1;
+    while (i + j < num_vars && BndCanBatchVars2(cctkGH, vars[i], vars[i + j]) &&
+           faces[i + j] == faces[i] && widths[i + j] == widths[i] &&
+           (tables[i + j] == tables[i] || widths[i] >= 0)) {
+      ++j;
+    }
+
+    /* BndCanBatchVars2 only puts variables with the same number of
+       active time levels together, so the check of the past time
+       levels for vars[i] holds for the whole batch */
+    BndPointwiseGrid g;
+    const int err = BndPointwiseGrid2(
+        cctkGH, vars[i], faces[i], widths[i], tables[i], F::interior_points,
+        F::past_timelevels, F::needs_coordinates, &g);
+    if (err < 0) {
+      retval = err;
+      continue;
+    }
+
+    std::vector<F> fs;
+    fs.reserve(j);
+    for (int k = 0; k < j; k++) {
+      fs.push_back(F(cctkGH, tables[i + k]));
+    }
+
+    switch (g.vtype) {
+    case CCTK_VARIABLE_REAL:
+      ApplyPointwise<F, CCTK_REAL>(cctkGH, g, vars + i, &fs[0], j);
+      break;
+#ifdef HAVE_CCTK_REAL4
+    case CCTK_VARIABLE_REAL4:
+      ApplyPointwise<F, CCTK_REAL4>(cctkGH, g, vars + i, &fs[0], j);
+      break;
+#endif
+#ifdef HAVE_CCTK_REAL8
+    case CCTK_VARIABLE_REAL8:
+      ApplyPointwise<F, CCTK_REAL8>(cctkGH, g, vars + i, &fs[0], j);
+      break;
+#endif
+#ifdef HAVE_CCTK_REAL16
+    case CCTK_VARIABLE_REAL16:
+      ApplyPointwise<F, CCTK_REAL16>(cctkGH, g, vars + i, &fs[0], j);
+      break;
+#endif
+    default:
+      CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                 "Unsupported variable type %d for variable '%s'", g.vtype,
+                 CCTK_VarName(vars[i]));
+      retval = -4;
+    }
+  }
+
+  return retval;
+}
+
+/**
+ * Register the functor F as the physical BC bc_name through the
+ * aliased function Boundary_RegisterPointwiseBC, which the calling
+ * thorn declares with USES FUNCTION. Pure functors are applied in the
+ * same phase as the local BCs of this thorn.
+ */
+template <class F>
+CCTK_INT RegisterPointwiseBC(const cGH *cctkGH, const char *bc_name) {
+  return Boundary_RegisterPointwiseBC(
+      cctkGH, (boundary_function)PointwiseBC<F>, bc_name, F::pure,
+      F::interior_points + F::past_timelevels);
+}
+
+} // namespace Boundary2
+
+#endif /* _BOUNDARY2_POINTWISE_HH_ */
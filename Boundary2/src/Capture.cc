@@ -0,0 +1,409 @@
+/*@@
+  @file      Capture.cc
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Capture of the boundary condition calls made by the task
+             engine.
+
+             With capture_calls set, every call of a BC function made
+             by the engine is appended to a binary file: the BC, the
+             variables with their faces, widths and tables, the
+             contents of the tables, the geometry of the component and
+             the symmetry handles, and afterwards the return value and
+             the time of the call.  Every variable is described once by
+             its name, group and type.  With capture_data the grid
+             functions of a call are also stored, all active time
+             levels before the call and the current one after it, as
+             are the variables named by COPY_FROM and, for Radiation
+             and Robin, the coordinates.  The replay tool in
+             bench/ re-executes the calls of such a file against the
+             kernels of this thorn or the reference kernels.
+
+             All values are stored in the byte order of the machine
+             which wrote the file; the header has a marker to check it.
+  @enddesc
+  @version   $Header$
+@@*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "cctk.h"
+#include "cctk_Arguments.h"
+#include "cctk_Parameters.h"
+#include "util_Table.h"
+
+#include "Capture.h"
+
+namespace Boundary2 {
+
+static std::mutex capture_mutex;
+static FILE *capture = NULL;
+static std::string capture_name;
+/* set once the file could not be opened or has been closed */
+static bool capture_done = false;
+static unsigned long capture_calls_written = 0;
+static std::set<int> capture_described;
+
+/* a record, assembled before it is written in one piece */
+struct BndRecord {
+  std::string bytes;
+
+  void Put(const void *p, size_t size) {
+    bytes.append(static_cast<const char *>(p), size);
+  }
+  void Byte(char c) { Put(&c, 1); }
+  void Int(int i) { Put(&i, sizeof i); }
+  void Real(double d) { Put(&d, sizeof d); }
+  /* int or CCTK_INT, which may be wider */
+  template <typename T> void Ints(const T *p, int n) {
+    for (int i = 0; i < n; i++) {
+      Int(p[i]);
+    }
+  }
+  void Reals(const CCTK_REAL *p, int n) {
+    for (int i = 0; i < n; i++) {
+      Real(p[i]);
+    }
+  }
+  void String(const std::string &s) {
+    Int(s.size());
+    Put(s.data(), s.size());
+  }
+};
+
+static std::string BndFullName(int var) {
+  char *name = CCTK_FullName(var);
+  const std::string s = name ? name : "";
+  free(name);
+  return s;
+}
+
+/* open the capture file of this process; called with the lock held */
+static bool BndOpenCapture(const cGH *cctkGH) {
+  DECLARE_CCTK_PARAMETERS;
+  if (capture || capture_done) {
+    return capture != NULL;
+  }
+  capture_name = capture_file;
+  const void *out_dir = capture_name[0] != '/'
+                            ? CCTK_ParameterGet("out_dir", "IO", NULL)
+                            : NULL;
+  if (out_dir && **(const char *const *)out_dir) {
+    capture_name =
+        std::string(*(const char *const *)out_dir) + "/" + capture_name;
+  }
+  capture_name += "." + std::to_string(CCTK_MyProc(cctkGH)) + ".bin";
+  capture = fopen(capture_name.c_str(), "wb");
+  if (!capture) {
+    capture_done = true;
+    CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+               "Cannot write the boundary capture to '%s'",
+               capture_name.c_str());
+    return false;
+  }
+  BndRecord header;
+  header.Put(BND_CAPTURE_MAGIC, sizeof BND_CAPTURE_MAGIC);
+  header.Int(BND_CAPTURE_VERSION);
+  header.Int(0x01020304);
+  header.Int(CCTK_MyProc(cctkGH));
+  fwrite(header.bytes.data(), 1, header.bytes.size(), capture);
+  return true;
+}
+
+/* a 'V' record for a variable not described yet */
+static void BndDescribeVar(BndRecord &rec, int var) {
+  if (var < 0 || !capture_described.insert(var).second) {
+    return;
+  }
+  const int group = CCTK_GroupIndexFromVarI(var);
+  char *group_name = CCTK_GroupName(group);
+  const int gtype = CCTK_GroupTypeI(group);
+  const char *vtype = CCTK_VarTypeName(CCTK_VarTypeI(var));
+  rec.Byte('V');
+  rec.Int(var);
+  rec.String(BndFullName(var));
+  rec.String(group_name ? group_name : "");
+  rec.String(vtype ? vtype : "");
+  rec.Byte(gtype == CCTK_GF ? 'G' : gtype == CCTK_ARRAY ? 'A' : 'S');
+  rec.Int(CCTK_GroupDimI(group));
+  rec.Int(CCTK_DeclaredTimeLevelsVI(var));
+  rec.Int(CCTK_NumVarsInGroupI(group));
+  rec.Int(var - CCTK_FirstVarIndexI(group));
+  free(group_name);
+}
+
+/* the variable named by the COPY_FROM key of a table, or -1 */
+static int BndCopyFrom(int table) {
+  CCTK_INT type, n;
+  if (table < 0 ||
+      Util_TableQueryValueInfo(table, &type, &n, "COPY_FROM") != 1) {
+    return -1;
+  }
+  if (type == CCTK_VARIABLE_INT) {
+    CCTK_INT var;
+    return Util_TableGetInt(table, &var, "COPY_FROM") == 1 ? var : -1;
+  }
+  std::vector<char> name(n + 1);
+  if (Util_TableGetString(table, n + 1, name.data(), "COPY_FROM") < 0) {
+    return -1;
+  }
+  return CCTK_VarIndex(name.data());
+}
+
+/* the Cartesian coordinates and the radius, or -1 */
+static void BndCoordVars(int dim, int coords[4]) {
+  char system[16];
+  snprintf(system, sizeof system, "cart%dd", dim);
+  for (int d = 0; d < 3; d++) {
+    coords[d] = d < dim && CCTK_CoordSystemHandle(system) >= 0
+                    ? CCTK_CoordIndex(d + 1, NULL, system)
+                    : -1;
+  }
+  snprintf(system, sizeof system, "spher%dd", dim);
+  coords[3] = CCTK_CoordSystemHandle(system) >= 0
+                  ? CCTK_CoordIndex(-1, "r", system)
+                  : -1;
+}
+
+/* whether a BC of this thorn reads the coordinates */
+static bool BndReadsCoords(const std::string &bc_name) {
+  return CCTK_Equals(bc_name.c_str(), "radiation") ||
+         CCTK_Equals(bc_name.c_str(), "robin");
+}
+
+/* the keys of a table with their values; values of other types than
+   CCTK_INT, CCTK_REAL and strings are left out */
+static void BndPutTable(BndRecord &rec, int table) {
+  BndRecord keys;
+  int nkeys = 0;
+  const int it = Util_TableItCreate(table);
+  for (; it >= 0 && Util_TableItQueryIsNonNull(it) > 0;
+       Util_TableItAdvance(it)) {
+    char key[256];
+    CCTK_INT type, n;
+    if (Util_TableItQueryKeyValueInfo(it, sizeof key, key, &type, &n) < 0) {
+      continue;
+    }
+    if (type == CCTK_VARIABLE_INT) {
+      std::vector<CCTK_INT> values(n);
+      if (Util_TableGetIntArray(table, n, values.data(), key) != n) {
+        continue;
+      }
+      keys.String(key);
+      keys.Byte('i');
+      keys.Int(n);
+      keys.Ints(values.data(), n);
+    } else if (type == CCTK_VARIABLE_REAL) {
+      std::vector<CCTK_REAL> values(n);
+      if (Util_TableGetRealArray(table, n, values.data(), key) != n) {
+        continue;
+      }
+      keys.String(key);
+      keys.Byte('r');
+      keys.Int(n);
+      keys.Reals(values.data(), n);
+    } else if (type == CCTK_VARIABLE_CHAR || type == CCTK_VARIABLE_STRING) {
+      std::vector<char> value(n + 1);
+      if (Util_TableGetString(table, n + 1, value.data(), key) < 0) {
+        continue;
+      }
+      keys.String(key);
+      keys.Byte('s');
+      keys.String(value.data());
+    } else {
+      continue;
+    }
+    nkeys++;
+  }
+  if (it >= 0) {
+    Util_TableItDestroy(it);
+  }
+  rec.Int(table);
+  rec.Int(nkeys);
+  rec.Put(keys.bytes.data(), keys.bytes.size());
+}
+
+/* the time levels of grid functions; other variables are left out */
+static void BndPutData(BndRecord &rec, const cGH *cctkGH,
+                       const std::vector<int> &vars, bool all_timelevels) {
+  size_t npoints = 1;
+  for (int d = 0; d < cctkGH->cctk_dim; d++) {
+    npoints *= cctkGH->cctk_ash[d];
+  }
+  BndRecord blocks;
+  int nblocks = 0;
+  for (int var : vars) {
+    if (var < 0 ||
+        CCTK_GroupTypeI(CCTK_GroupIndexFromVarI(var)) != CCTK_GF) {
+      continue;
+    }
+    const int ntl = all_timelevels ? CCTK_ActiveTimeLevelsVI(cctkGH, var) : 1;
+    const size_t size = npoints * CCTK_VarTypeSize(CCTK_VarTypeI(var));
+    for (int tl = 0; tl < ntl; tl++) {
+      const void *data = cctkGH->data[var][tl];
+      if (!data) {
+        continue;
+      }
+      blocks.Int(var);
+      blocks.Int(tl);
+      const unsigned long long bytes = size;
+      blocks.Put(&bytes, sizeof bytes);
+      blocks.Put(data, size);
+      nblocks++;
+    }
+  }
+  rec.Int(nblocks);
+  rec.Put(blocks.bytes.data(), blocks.bytes.size());
+}
+
+BndCapture::BndCapture(const cGH *cctkGH_, const std::string &bc_name, int n_,
+                       const CCTK_INT *vars_, const CCTK_INT *faces,
+                       const CCTK_INT *widths, const CCTK_INT *tables)
+    : cctkGH(cctkGH_), n(n_), vars(vars_), id(0), retval(0) {
+  DECLARE_CCTK_PARAMETERS;
+  enabled = capture_calls;
+  if (!enabled) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(capture_mutex);
+  if (!BndOpenCapture(cctkGH)) {
+    enabled = false;
+    return;
+  }
+  id = capture_calls_written++;
+
+  std::vector<int> data_vars(vars, vars + n);
+  std::vector<int> table_handles;
+  BndRecord rec;
+  for (int i = 0; i < n; i++) {
+    BndDescribeVar(rec, vars[i]);
+    /* Copy reads the variables following the source for the
+       following variables of a call */
+    const int copy_from = BndCopyFrom(tables[i]);
+    const int group = CCTK_GroupIndexFromVarI(copy_from);
+    for (int k = 0; copy_from >= 0 && k < n; k++) {
+      const int from = copy_from + k;
+      if (CCTK_GroupIndexFromVarI(from) != group) {
+        break;
+      }
+      if (std::find(data_vars.begin(), data_vars.end(), from) ==
+          data_vars.end()) {
+        BndDescribeVar(rec, from);
+        data_vars.push_back(from);
+      }
+    }
+    if (tables[i] >= 0 &&
+        std::find(table_handles.begin(), table_handles.end(), tables[i]) ==
+            table_handles.end()) {
+      table_handles.push_back(tables[i]);
+    }
+  }
+
+  const int dim = cctkGH->cctk_dim;
+  int coords[4];
+  BndCoordVars(dim, coords);
+  for (int c = 0; c < 4; c++) {
+    BndDescribeVar(rec, coords[c]);
+    if (BndReadsCoords(bc_name)) {
+      data_vars.push_back(coords[c]);
+    }
+  }
+  CCTK_INT symmetry_handles[6] = {-1, -1, -1, -1, -1, -1};
+  const int symtable = SymmetryTableHandleForGrid(cctkGH);
+  if (dim <= 3 && symtable >= 0) {
+    Util_TableGetIntArray(symtable, 2 * dim, symmetry_handles,
+                          "symmetry_handle");
+  }
+  rec.Byte('C');
+  rec.Put(&id, sizeof id);
+  rec.String(bc_name);
+  rec.Int(cctkGH->cctk_iteration);
+  rec.Real(cctkGH->cctk_time);
+  rec.Real(cctkGH->cctk_delta_time);
+  rec.Int(dim);
+  rec.Ints(cctkGH->cctk_gsh, dim);
+  rec.Ints(cctkGH->cctk_lsh, dim);
+  rec.Ints(cctkGH->cctk_lbnd, dim);
+  rec.Ints(cctkGH->cctk_ash, dim);
+  rec.Ints(cctkGH->cctk_nghostzones, dim);
+  rec.Ints(cctkGH->cctk_levfac, dim);
+  rec.Ints(cctkGH->cctk_bbox, 2 * dim);
+  rec.Ints(symmetry_handles, 2 * std::min(dim, 3));
+  rec.Reals(cctkGH->cctk_origin_space, dim);
+  rec.Reals(cctkGH->cctk_delta_space, dim);
+  rec.Ints(coords, 4);
+  rec.Int(n);
+  rec.Ints(vars, n);
+  rec.Ints(faces, n);
+  rec.Ints(widths, n);
+  rec.Ints(tables, n);
+  rec.Int(table_handles.size());
+  for (int table : table_handles) {
+    BndPutTable(rec, table);
+  }
+  if (capture_data) {
+    BndPutData(rec, cctkGH, data_vars, true);
+  } else {
+    rec.Int(0);
+  }
+  fwrite(rec.bytes.data(), 1, rec.bytes.size(), capture);
+
+  start = std::chrono::steady_clock::now();
+}
+
+BndCapture::~BndCapture() {
+  if (!enabled) {
+    return;
+  }
+  const double seconds = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+  DECLARE_CCTK_PARAMETERS;
+  BndRecord rec;
+  rec.Byte('R');
+  rec.Put(&id, sizeof id);
+  rec.Int(retval);
+  rec.Real(seconds);
+  if (capture_data) {
+    BndPutData(rec, cctkGH, std::vector<int>(vars, vars + n), false);
+  } else {
+    rec.Int(0);
+  }
+  std::lock_guard<std::mutex> lock(capture_mutex);
+  /* the file may have been closed while the call ran */
+  if (capture) {
+    fwrite(rec.bytes.data(), 1, rec.bytes.size(), capture);
+  }
+}
+
+} // namespace Boundary2
+
+/*@@
+   @routine    Boundary2_CloseCapture
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Close the file of the captured boundary calls of this
+               process
+   @enddesc
+@@*/
+extern "C" void Boundary2_CloseCapture(CCTK_ARGUMENTS) {
+  using namespace Boundary2;
+
+  std::lock_guard<std::mutex> lock(capture_mutex);
+  if (!capture) {
+    return;
+  }
+  fclose(capture);
+  capture = NULL;
+  capture_done = true;
+  CCTK_VInfo(CCTK_THORNSTRING, "Captured %lu boundary calls to '%s'",
+             capture_calls_written, capture_name.c_str());
+}
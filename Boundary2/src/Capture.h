@@ -0,0 +1,65 @@
+/*@@
+  @file      Capture.h
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Capture of the boundary condition calls made by the task
+             engine, for replaying them offline
+  @enddesc
+  @version   $Header$
+@@*/
+
+#ifndef _CAPTURE_H_
+#define _CAPTURE_H_
+
+#ifndef __cplusplus
+#error "Capture.h can only be used from C++"
+#endif
+
+#include <chrono>
+#include <string>
+
+#include "cctk.h"
+
+namespace Boundary2 {
+
+/** First bytes of a capture file */
+#define BND_CAPTURE_MAGIC "BND2CAP"
+#define BND_CAPTURE_VERSION 1
+
+/**
+ * Records one call of a BC function for n variables, if capture_calls
+ * is set: the arguments, the contents of the tables, the geometry of
+ * the component and, with capture_data, the variables before the call.
+ * Done() passes the return value of the call through; the result and,
+ * with capture_data, the variables after the call are recorded on
+ * destruction. Safe to use from several threads at once.
+ */
+class BndCapture {
+public:
+  BndCapture(const cGH *cctkGH, const std::string &bc_name, int n,
+             const CCTK_INT *vars, const CCTK_INT *faces,
+             const CCTK_INT *widths, const CCTK_INT *tables);
+  ~BndCapture();
+
+  CCTK_INT Done(CCTK_INT retval_) {
+    retval = retval_;
+    return retval;
+  }
+
+private:
+  BndCapture(const BndCapture &);
+  BndCapture &operator=(const BndCapture &);
+
+  bool enabled;
+  const cGH *cctkGH;
+  int n;
+  const CCTK_INT *vars;
+  unsigned long id;
+  CCTK_INT retval;
+  std::chrono::steady_clock::time_point start;
+};
+
+} // namespace Boundary2
+
+#endif /* _CAPTURE_H_ */
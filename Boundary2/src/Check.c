@@ -16,6 +16,7 @@
 
 #include "cctk.h"
 #include "cctk_Arguments.h"
+#include "cctk_Parameters.h"
 
 #include <assert.h>
 #include <stdlib.h>
@@ -137,3 +138,84 @@ void BndSanityCheckWidths2(const cGH *GH, CCTK_INT varindex, CCTK_INT dim,
     }
   }
 }
+
+/*@@
+  @routine    BndCanBatchVars2
+  @date       Sun Oct 18 2026
+  @author     Samuel Cupp
+  @desc
+              Checks whether two variables can be handled by the same
+              call of a boundary condition kernel, which takes the
+              dimension, type and staggering of all its variables from
+              the first one.  This holds for variables of one group,
+              and, with batch_across_groups, for grid functions of
+              groups which agree in dimension, type, staggering and
+              number of declared and active time levels.
+  @enddesc
+  @calls      CCTK_GroupIndexFromVarI
+              CCTK_GroupTypeI
+              CCTK_GroupDimI
+              CCTK_VarTypeI
+              CCTK_DeclaredTimeLevelsVI
+              CCTK_ActiveTimeLevelsVI
+              CCTK_GroupStaggerDirArrayGI
+  @history
+  @hdate      Sun Oct 18 2026
+  @hauthor    Samuel Cupp
+  @hdesc      Compare the active time levels as well, since kernels
+              which read past levels check them for the first variable
+              only
+  @endhistory
+  @var        GH
+  @vdesc      Pointer to CCTK grid hierarchy
+  @vtype      const cGH *
+  @vio        in
+  @endvar
+  @var        var1
+  @vdesc      first variable of the batch
+  @vtype      CCTK_INT
+  @vio        in
+  @endvar
+  @var        var2
+  @vdesc      variable to add to the batch
+  @vtype      CCTK_INT
+  @vio        in
+  @endvar
+  @returntype int
+  @returndesc
+              1 if the variables can be batched, 0 otherwise
+  @endreturndesc
+@@*/
+
+int BndCanBatchVars2(const cGH *GH, CCTK_INT var1, CCTK_INT var2) {
+  DECLARE_CCTK_PARAMETERS;
+  const int g1 = CCTK_GroupIndexFromVarI(var1);
+  const int g2 = CCTK_GroupIndexFromVarI(var2);
+  CCTK_INT stagger1[MAX_DIM], stagger2[MAX_DIM];
+  int dim, d;
+
+  if (g1 == g2) {
+    return g1 >= 0;
+  }
+  if (!batch_across_groups || g1 < 0 || g2 < 0 ||
+      CCTK_GroupTypeI(g1) != CCTK_GF || CCTK_GroupTypeI(g2) != CCTK_GF) {
+    return 0;
+  }
+  dim = CCTK_GroupDimI(g1);
+  if (dim != CCTK_GroupDimI(g2) || dim > MAX_DIM ||
+      CCTK_VarTypeI(var1) != CCTK_VarTypeI(var2) ||
+      CCTK_DeclaredTimeLevelsVI(var1) != CCTK_DeclaredTimeLevelsVI(var2) ||
+      CCTK_ActiveTimeLevelsVI(GH, var1) != CCTK_ActiveTimeLevelsVI(GH, var2)) {
+    return 0;
+  }
+  if (CCTK_GroupStaggerDirArrayGI(stagger1, dim, g1) < 0 ||
+      CCTK_GroupStaggerDirArrayGI(stagger2, dim, g2) < 0) {
+    return 0;
+  }
+  for (d = 0; d < dim; d++) {
+    if (stagger1[d] != stagger2[d]) {
+      return 0;
+    }
+  }
+  return 1;
+}
@@ -0,0 +1,525 @@
+/*@@
+  @file      ExtrapolateBoundary.c
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Routines for applying polynomial extrapolation boundary
+             conditions
+  @enddesc
+  @history
+  @hdate
+  @hauthor
+  @hdesc
+  @endhistory
+  @version   $Header$
+@@*/
+
+/*#define DEBUG_BOUNDARY*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cctk.h"
+#include "util_Table.h"
+#include "util_ErrorCodes.h"
+#include "cctk_Parameters.h"
+#include "Boundary2.h"
+
+static int ApplyBndExtrapolate(const cGH *GH, const CCTK_INT *in_widths,
+                               CCTK_INT faces, CCTK_INT order,
+                               int first_var, int num_vars);
+
+/********************************************************************
+ ********************    External Routines   ************************
+ ********************************************************************/
+/*@@
+   @routine    Bndry_Extrapolate
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Top level function which is registered as handling
+               the Extrapolate boundary condition
+   @enddesc
+   @calls      ApplyBndExtrapolate
+
+   @var        GH
+   @vdesc      Pointer to CCTK grid hierarchy
+   @vtype      const cGH *
+   @vio        in
+   @endvar
+   @var        num_vars
+   @vdesc      number of variables passed in through var_indices[]
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @var        var_indices
+   @vdesc      array of variable indicies to which to apply this boundary
+               condition
+   @vtype      CCTK_INT *
+   @vio        in
+   @endvar
+   @var        faces
+   @vdesc      array of set of faces to which to apply the bc
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @var        widths
+   @vdesc      array of boundary widths for each variable
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @var        table_handles
+   @vdesc      array of table handles which hold extra arguments
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @returntype CCTK_INT
+   @returndesc
+               return code of @seeroutine ApplyBndExtrapolate
+               -21 error reading boundary width array from table
+               -22 wrong size boundary width array in table
+               -23 invalid extrapolation order in table
+   @endreturndesc
+@@*/
+CCTK_INT Bndry_Extrapolate(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
+                           CCTK_INT *faces, CCTK_INT *widths,
+                           CCTK_INT *tables) {
+  int i, j, k, gi, gdim, max_gdim, err, retval;
+
+  /* variables to pass to ApplyBndExtrapolate */
+  CCTK_INT *width_alldirs; /* width of boundary in all directions */
+  CCTK_INT order;          /* order of the extrapolating polynomial */
+
+  retval = 0;
+  width_alldirs = NULL;
+  max_gdim = 0;
+
+  /* loop through variables, j at a time */
+  for (i = 0; i < num_vars; i += j) {
+    /* find other adjacent vars which are selected for identical bcs,
+       as for Flat */
+    j = 1;
+    gi = CCTK_GroupIndexFromVarI(vars[i]);
+    while (i + j < num_vars && vars[i + j] == vars[i] + j &&
+           BndCanBatchVars2(GH, vars[i], vars[i + j]) &&
+           tables[i + j] == tables[i] && faces[i + j] == faces[i] &&
+           widths[i + j] == widths[i]) {
+      ++j;
+    }
+
+    /* Determine boundary width on all faces */
+    /* allocate memory for buffer */
+    gdim = CCTK_GroupDimI(gi);
+    if (gdim > max_gdim) {
+      width_alldirs =
+          (CCTK_INT *)realloc(width_alldirs, 2 * gdim * sizeof(CCTK_INT));
+      max_gdim = gdim;
+    }
+
+    /* fill it with values, either from table or the boundary_width
+       parameter */
+    if (widths[i] < 0) {
+      err = Util_TableGetIntArray(tables[i], 2 * gdim, width_alldirs,
+                                  "BOUNDARY_WIDTH");
+      if (err < 0) {
+        CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                   "Error %d when reading boundary width array from table "
+                   "for %s",
+                   err, CCTK_VarName(vars[i]));
+        free(width_alldirs);
+        return -21;
+      } else if (err != 2 * gdim) {
+        CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                   "Boundary width array for %s has %d elements, but %d "
+                   "expected",
+                   CCTK_VarName(vars[i]), err, 2 * gdim);
+        free(width_alldirs);
+        return -22;
+      }
+    } else {
+      for (k = 0; k < 2 * gdim; ++k) {
+        width_alldirs[k] = widths[i];
+      }
+    }
+
+    /* the order of the extrapolation, linear by default */
+    order = 1;
+    if (tables[i] >= 0) {
+      err = Util_TableGetInt(tables[i], &order, "ORDER");
+      if (err < 0 && err != UTIL_ERROR_TABLE_NO_SUCH_KEY) {
+        CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                   "Error %d when reading extrapolation order from table "
+                   "for %s",
+                   err, CCTK_VarName(vars[i]));
+        retval = -23;
+        continue;
+      }
+    }
+    if (order < 0) {
+      CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                 "Invalid extrapolation order %d for %s, must be 0 or "
+                 "larger",
+                 (int)order, CCTK_VarName(vars[i]));
+      retval = -23;
+      continue;
+    }
+
+    /* Apply the boundary condition */
+    if ((err = ApplyBndExtrapolate(GH, width_alldirs, faces[i], order,
+                                   vars[i], j)) < 0) {
+      CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                 "ApplyBndExtrapolate() returned %d", err);
+      retval = err;
+    }
+  }
+
+  free(width_alldirs);
+
+  return retval;
+}
+
+/********************************************************************
+ *********************     Local Routines   *************************
+ ********************************************************************/
+
+/* maximum dimension we can deal with */
+#define MAXDIM 3
+
+/* macro to compute the linear index of a 3D point */
+#define INDEX_3D(ash, i, j, k) ((i) + (ash)[0] * ((j) + (ash)[1] * (k)))
+
+/*@@
+   @routine    EXTRAPOLATE_ROWS
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Macro to set the points of the rows of the boundary zones
+               of both faces of direction d from the order + 1 first
+               interior points along the normal, weighted with the
+               coefficients of their depth, with the rows shared out
+               among OpenMP threads a plane of rows at a time
+   @enddesc
+
+   @var        cctk_type
+   @vdesc      CCTK datatype of the variable
+   @vtype      <cctk_type>
+   @vio        in
+   @endvar
+@@*/
+#define EXTRAPOLATE_ROWS(cctk_type)                                            \
+  {                                                                            \
+    BndRow2 _row;                                                              \
+    int _n = BndRowsShare2(&rows, threaded, &_row);                            \
+                                                                               \
+    while (_n > 0) {                                                           \
+      const int _face = 2 * d + _row.upper;                                    \
+      const int _nrows = _n < BND_PLANE_ROWS2(rows, _row)                      \
+                             ? _n : BND_PLANE_ROWS2(rows, _row);               \
+      /* rows of x faces run along the normal, and the rows of the upper y     \
+         face from the boundary inwards */                                     \
+      const int _to_step = d == 0 && _row.upper ? -1 : 1;                      \
+      const int _from_step = d == 0 ? 0 : 1;                                   \
+      const ptrdiff_t _to_stride = d == 1 && _row.upper ? -ash[0] : ash[0];    \
+      const ptrdiff_t _from_stride = d == 1 ? 0 : ash[0];                      \
+      const ptrdiff_t _inward =                                                \
+          (_row.upper ? -1 : 1) *                                              \
+          (ptrdiff_t)(d == 0 ? 1 : d == 1 ? ash[0] : ash[0] * ash[1]);         \
+      const int _nx = extent[_face][0];                                        \
+      int _to[MAXDIM], _from[MAXDIM], _jj, _ii, _k;                            \
+      cctk_type *_to_row;                                                      \
+      const cctk_type *_from_row;                                              \
+                                                                               \
+      _to[0] = 0;                                                              \
+      _to[1] = _row.j;                                                         \
+      _to[2] = _row.k;                                                         \
+      _from[0] = _to[0];                                                       \
+      _from[1] = _to[1];                                                       \
+      _from[2] = _to[2];                                                       \
+      if (_row.upper) {                                                        \
+        _to[d] = lsh[d] - 1 - _to[d];                                          \
+        _from[d] = lsh[d] - widths[_face] - 1;                                 \
+      } else {                                                                 \
+        _from[d] = widths[_face];                                              \
+      }                                                                        \
+      _to_row = (cctk_type *)GH->data[first_var + _row.var][timelvl] +         \
+                INDEX_3D(ash, _to[0], _to[1], _to[2]);                         \
+      _from_row = (const cctk_type *)GH->data[first_var + _row.var][timelvl] + \
+                  INDEX_3D(ash, _from[0], _from[1], _from[2]);                 \
+      for (_jj = 0; _jj < _nrows; _jj++) {                                     \
+        /* the boundary points of a row lie at one depth, except on x          \
+           faces */                                                            \
+        const int _depth = d == 1 ? _row.j + _jj : _row.k;                     \
+                                                                               \
+        for (_ii = 0; _ii < _nx; _ii++) {                                      \
+          const CCTK_REAL *_c =                                                \
+              coeffs[_face] + (d == 0 ? _ii : _depth) * (order + 1);           \
+          const cctk_type *_f = _from_row + _ii * _from_step;                  \
+          cctk_type _sum = (cctk_type)_c[0] * _f[0];                           \
+          for (_k = 1; _k <= order; _k++) {                                    \
+            _sum += (cctk_type)_c[_k] * _f[_k * _inward];                      \
+          }                                                                    \
+          _to_row[_ii * _to_step] = _sum;                                      \
+        }                                                                      \
+        _to_row += _to_stride;                                                 \
+        _from_row += _from_stride;                                             \
+      }                                                                        \
+      _n -= _nrows;                                                            \
+      BND_NEXT_PLANE2(rows, _row);                                             \
+    }                                                                          \
+  }
+
+/*@@
+   @routine    ApplyBndExtrapolate
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Apply polynomial extrapolation boundary conditions to a
+               group of grid functions given by their indices.
+
+               Every boundary point is set to the value at its position
+               of the polynomial of degree order through the order + 1
+               first interior points along the normal of its face.  The
+               boundary points only read interior points, so the loop is
+               the one of ApplyBndFlat, which is the case order = 0, and
+               the (variable, face, row) work items are spread over
+               OpenMP threads.  The weights of the interior points are
+               the Lagrange coefficients of the equidistant points
+               0, ..., order evaluated at -m, where m is the distance of
+               the boundary point from the first interior point; they are
+               integers and computed once per face.
+   @enddesc
+
+   @var        GH
+   @vdesc      Pointer to CCTK grid hierarchy
+   @vtype      const cGH *
+   @vio        in
+   @endvar
+   @var        in_widths
+   @vdesc      boundary widths for all directions
+   @vtype      CCTK_INT [ dimension of variable(s) ]
+   @vio        in
+   @endvar
+   @var        faces
+   @vdesc      set of faces to which to apply the bc
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @var        order
+   @vdesc      degree of the extrapolating polynomial
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @var        first_var
+   @vdesc      index of first variable to apply boundaries to
+   @vtype      int
+   @vio        in
+   @endvar
+   @var        num_vars
+   @vdesc      number of variables
+   @vtype      int
+   @vio        in
+   @endvar
+
+   @calls      CCTK_GroupIndexFromVarI
+               CCTK_GroupDimI
+               CCTK_VarTypeI
+               BndUseThreads2
+               BndFaceRows2
+               BndRowsShare2
+               BndCountWork2
+
+   @returntype int
+   @returndesc
+                0 for success
+               -1 if dimension is not supported
+               -4 if the variable type is not supported
+   @endreturndesc
+@@*/
+static int ApplyBndExtrapolate(const cGH *GH, const CCTK_INT *in_widths,
+                               CCTK_INT faces, CCTK_INT order,
+                               int first_var, int num_vars) {
+  int i, d, f, k, m, pass, split;
+  int vtype, vtypesize, gindex, gdim, timelvl;
+  int doBC[2 * MAXDIM], ash[MAXDIM], lsh[MAXDIM];
+  int extent[2 * MAXDIM][MAXDIM], nrows[2 * MAXDIM];
+  CCTK_INT widths[2 * MAXDIM];
+  CCTK_INT symtable;
+  CCTK_INT symbnd[2 * MAXDIM];
+  CCTK_INT is_physical[2 * MAXDIM];
+  CCTK_INT ierr;
+  CCTK_REAL *coeffs[2 * MAXDIM];
+
+  /* get the group index of the variables */
+  gindex = CCTK_GroupIndexFromVarI(first_var);
+
+  /* get the number of dimensions and the type of the variables */
+  gdim = CCTK_GroupDimI(gindex);
+  vtype = CCTK_VarTypeI(first_var);
+  vtypesize = CCTK_VarTypeSize(vtype);
+
+  /* make sure we can deal with this number of dimensions */
+  if (gdim > MAXDIM) {
+    CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+               "ApplyBndExtrapolate: Variable dimension of %d not "
+               "supported",
+               gdim);
+    return (-1);
+  }
+
+  /* make sure we can deal with this type */
+  switch (vtype) {
+  case CCTK_VARIABLE_REAL:
+#ifdef HAVE_CCTK_REAL4
+  case CCTK_VARIABLE_REAL4:
+#endif
+#ifdef HAVE_CCTK_REAL8
+  case CCTK_VARIABLE_REAL8:
+#endif
+#ifdef HAVE_CCTK_REAL16
+  case CCTK_VARIABLE_REAL16:
+#endif
+    break;
+  default:
+    CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+               "Unsupported variable type %d for variable '%s'", vtype,
+               CCTK_VarName(first_var));
+    return (-4);
+  }
+
+  memcpy(widths, in_widths, 2 * gdim * sizeof *widths);
+
+  /* initialize arrays for variables with less dimensions than MAXDIM
+     so that we can use the INDEX_3D macro later on */
+  for (i = gdim; i < MAXDIM; i++) {
+    ash[i] = 1;
+    lsh[i] = 1;
+  }
+
+  /* get the current timelevel */
+  timelvl = 0;
+
+  /* see if we have a physical boundary */
+  symtable = SymmetryTableHandleForGrid(GH);
+  if (symtable < 0)
+    CCTK_WARN(0, "internal error");
+  ierr = Util_TableGetIntArray(symtable, 2 * gdim, symbnd, "symmetry_handle");
+  if (ierr != 2 * gdim)
+    CCTK_WARN(0, "internal error");
+  for (i = 0; i < 2 * gdim; i++) {
+    is_physical[i] = symbnd[i] < 0;
+  }
+
+  /* sanity check on width of boundary,  */
+  BndSanityCheckWidths2(GH, first_var, gdim, widths, "Extrapolate");
+
+  /* Apply condition if:
+     + boundary is a physical boundary
+     + boundary is an outer boundary
+     + have enough grid points for the boundary and the interior points
+       the polynomial goes through
+  */
+  for (i = 0; i < 2 * gdim; i++) {
+    doBC[i] = is_physical[i] && (faces == CCTK_ALL_FACES || (faces & (1<<i)));
+  }
+  for (i = 0; i < gdim; i++) {
+    ash[i] = GH->cctk_ash[i];
+    lsh[i] = GH->cctk_lsh[i];
+    doBC[i * 2] &=
+        GH->cctk_lsh[i] > widths[i * 2] + order && GH->cctk_bbox[i * 2];
+    doBC[i * 2 + 1] &= GH->cctk_lsh[i] > widths[i * 2 + 1] + order &&
+                       GH->cctk_bbox[i * 2 + 1];
+  }
+
+  /* the boundary zone of each face is a box of extent[face][] points,
+     which is traversed in rows along the x direction.  coeffs[face]
+     holds the order + 1 weights of each boundary point of the face,
+     from the outermost one inwards. */
+  for (f = 0; f < 2 * gdim; f++) {
+    for (i = 0; i < MAXDIM; i++) {
+      extent[f][i] = lsh[i];
+    }
+    extent[f][f / 2] = widths[f];
+    nrows[f] = doBC[f] ? extent[f][1] * extent[f][2] : 0;
+
+    coeffs[f] = NULL;
+    if (doBC[f] && widths[f] > 0) {
+      coeffs[f] = (CCTK_REAL *)malloc(widths[f] * (order + 1) *
+                                      sizeof(CCTK_REAL));
+      for (i = 0; i < widths[f]; i++) {
+        m = widths[f] - i;
+        for (k = 0; k <= order; k++) {
+          /* L_k(-m) = prod_{j != k} (-m - j) / (k - j) */
+          CCTK_REAL num = 1, den = 1;
+          int jj;
+          for (jj = 0; jj <= order; jj++) {
+            if (jj != k) {
+              num *= -m - jj;
+              den *= k - jj;
+            }
+          }
+          coeffs[f][i * (order + 1) + k] = num / den;
+        }
+      }
+    }
+  }
+
+  /* now apply the boundaries direction by direction, since edges and
+     corners are extrapolated from points set by an earlier direction.
+     The lower and upper face of one direction are independent, unless
+     one face's boundary zone contains points the other reads. */
+  for (d = 0; d < gdim; d++) {
+#ifdef DEBUG_BOUNDARY
+    if (doBC[2 * d]) {
+      printf("Boundary: Applying lower %c extrapolation boundary "
+             "condition\n", "xyz"[d]);
+    }
+    if (doBC[2 * d + 1]) {
+      printf("Boundary: Applying upper %c extrapolation boundary "
+             "condition\n", "xyz"[d]);
+    }
+#endif /* DEBUG_BOUNDARY */
+    split = lsh[d] <= widths[2 * d] + widths[2 * d + 1] + order;
+    for (pass = 0; pass <= split; pass++) {
+      const int nlower = split && pass == 1 ? 0 : nrows[2 * d];
+      const int nupper = split && pass == 0 ? 0 : nrows[2 * d + 1];
+      const CCTK_INT npoints =
+          num_vars * (nlower * extent[2 * d][0] +
+                      nupper * extent[2 * d + 1][0]);
+      const BndRows2 rows =
+          BndFaceRows2(num_vars, nlower ? extent[2 * d] : NULL,
+                       nupper ? extent[2 * d + 1] : NULL);
+      const int threaded = BndUseThreads2(npoints);
+
+      /* each point reads order + 1 interior points and writes itself */
+      BndCountWork2(npoints, (order + 2) * vtypesize, 2 * order + 1);
+
+      switch (vtype) {
+      case CCTK_VARIABLE_REAL:
+        BND_PARALLEL_IF2(threaded, EXTRAPOLATE_ROWS(CCTK_REAL));
+        break;
+#ifdef HAVE_CCTK_REAL4
+      case CCTK_VARIABLE_REAL4:
+        BND_PARALLEL_IF2(threaded, EXTRAPOLATE_ROWS(CCTK_REAL4));
+        break;
+#endif
+#ifdef HAVE_CCTK_REAL8
+      case CCTK_VARIABLE_REAL8:
+        BND_PARALLEL_IF2(threaded, EXTRAPOLATE_ROWS(CCTK_REAL8));
+        break;
+#endif
+#ifdef HAVE_CCTK_REAL16
+      case CCTK_VARIABLE_REAL16:
+        BND_PARALLEL_IF2(threaded, EXTRAPOLATE_ROWS(CCTK_REAL16));
+        break;
+#endif
+      }
+    }
+  }
+
+  for (f = 0; f < 2 * gdim; f++) {
+    free(coeffs[f]);
+  }
+
+  return (0);
+}
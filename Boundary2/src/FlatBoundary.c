@@ -15,6 +15,7 @@
 
 /*#define DEBUG_BOUNDARY*/
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -97,13 +98,13 @@ CCTK_INT Bndry_Flat(const cGH *GH, const CCTK_INT num_vars, const CCTK_INT *vars
   for (i = 0; i < num_vars; i += j) {
     /* find other adjacent vars which are selected for identical bcs */
     j = 1;
-    /* Since GFs are allowed to have different staggering, the best we
-       can do is find variables of the same group which are selected
-       for identical bcs.  If all GFs had the same staggering then we
-       could group many GFs together. */
+    /* GFs are allowed to have different staggering, so only variables
+       of one group, or of groups with the same shape and staggering,
+       which are selected for identical bcs are handled together (see
+       BndCanBatchVars2). */
     gi = CCTK_GroupIndexFromVarI(vars[i]);
     while (i + j < num_vars && vars[i + j] == vars[i] + j &&
-           CCTK_GroupIndexFromVarI(vars[i + j]) == gi &&
+           BndCanBatchVars2(GH, vars[i], vars[i + j]) &&
            tables[i + j] == tables[i] && faces[i + j] == faces[i] &&
            widths[i + j] == widths[i]) {
       ++j;
@@ -171,52 +172,71 @@ CCTK_INT Bndry_Flat(const cGH *GH, const CCTK_INT num_vars, const CCTK_INT *vars
 #define INDEX_3D(ash, i, j, k) ((i) + (ash)[0] * ((j) + (ash)[1] * (k)))
 
 /*@@
-   @routine    FLAT_BOUNDARY
-   @date       Tue 10 Apr 2001
-   @author     Thomas Radke
+   @routine    FLAT_ROWS
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
    @desc
-               Macro to apply flat boundary conditions to a variable
-               Currently it is limited up to 3D variables only.
+               Macro to copy the first interior point along the normal
+               into the rows of the boundary zones of both faces of
+               direction d, with the rows shared out among OpenMP
+               threads a plane of rows at a time.  The size of an
+               element is a constant where possible, so that the copy
+               of an element is not a call to memcpy.
    @enddesc
 
-   @var        doBC
-   @vdesc      flag telling whether to apply boundary conditions or not
-   @vtype      int
-   @vio        in
-   @endvar
-   @var        iend, jend, kend
-   @vdesc      upper ranges for the loopers
-   @vtype      int
-   @vio        in
-   @endvar
-   @var        ii_to, jj_to, kk_to
-   @vdesc      indices of the current grid point to copy to
-   @vtype      int
-   @vio        in
-   @endvar
-   @var        ii_from, jj_from, kk_from
-   @vdesc      indices of the current grid point to copy from
+   @var        size
+   @vdesc      size of an element in bytes
    @vtype      int
    @vio        in
    @endvar
 @@*/
-#define FLAT_BOUNDARY(doBC, iend, jend, kend, ii_to, jj_to, kk_to, ii_from,    \
-                      jj_from, kk_from)                                        \
+#define FLAT_ROWS(size)                                                        \
   {                                                                            \
-    if (doBC) {                                                                \
-      for (k = 0; k < kend; k++) {                                             \
-        for (j = 0; j < jend; j++) {                                           \
-          for (i = 0; i < iend; i++) {                                         \
-            int _index_to, _index_from;                                        \
+    BndRow2 _row;                                                              \
+    int _n = BndRowsShare2(&rows, threaded, &_row);                            \
                                                                                \
-            _index_to = INDEX_3D(ash, ii_to, jj_to, kk_to) * vtypesize;        \
-            _index_from =                                                      \
-                INDEX_3D(ash, ii_from, jj_from, kk_from) * vtypesize;          \
-            memcpy((char *)GH->data[var][timelvl] + _index_to,                 \
-                   (char *)GH->data[var][timelvl] + _index_from, vtypesize);   \
-          }                                                                    \
+    while (_n > 0) {                                                           \
+      const int _face = 2 * d + _row.upper;                                    \
+      const int _nrows = _n < BND_PLANE_ROWS2(rows, _row)                      \
+                             ? _n : BND_PLANE_ROWS2(rows, _row);               \
+      /* rows of x faces run along the normal, so the interior point is        \
+         the same for a whole row of an x face and a whole plane of a y        \
+         face */                                                               \
+      const int _from_step = d == 0 ? 0 : 1;                                   \
+      const ptrdiff_t _from_stride = d == 1 ? 0 : ash[0];                      \
+      const int _nx = extent[_face][0];                                        \
+      int _to[MAXDIM], _from[MAXDIM], _jj, _ii;                                \
+      char *_data, *_to_row;                                                   \
+      const char *_from_row;                                                   \
+                                                                               \
+      _to[0] = 0;                                                              \
+      _to[1] = _row.j;                                                         \
+      _to[2] = _row.k;                                                         \
+      _from[0] = _to[0];                                                       \
+      _from[1] = _to[1];                                                       \
+      _from[2] = _to[2];                                                       \
+      /* the order of the points does not matter, so the zone of an upper      \
+         face is traversed outwards like that of a lower one */                \
+      if (_row.upper) {                                                        \
+        _to[d] += lsh[d] - widths[_face];                                      \
+        _from[d] = lsh[d] - widths[_face] - 1;                                 \
+      } else {                                                                 \
+        _from[d] = widths[_face];                                              \
+      }                                                                        \
+      _data = (char *)GH->data[first_var + _row.var][timelvl];                 \
+      _to_row = _data + INDEX_3D(ash, _to[0], _to[1], _to[2]) * (size);        \
+      _from_row =                                                              \
+          _data + INDEX_3D(ash, _from[0], _from[1], _from[2]) * (size);        \
+      for (_jj = 0; _jj < _nrows; _jj++) {                                     \
+        for (_ii = 0; _ii < _nx; _ii++) {                                      \
+          memcpy(_to_row + _ii * (size),                                       \
+                 _from_row + _ii * _from_step * (size), (size));               \
         }                                                                      \
+        _to_row += ash[0] * (size);                                            \
+        _from_row += _from_stride * (size);                                    \
       }                                                                        \
+      _n -= _nrows;                                                            \
+      BND_NEXT_PLANE2(rows, _row);                                             \
     }                                                                          \
   }
 
@@ -269,12 +289,31 @@ CCTK_INT Bndry_Flat(const cGH *GH, const CCTK_INT num_vars, const CCTK_INT *vars
                CCTK_GroupDimI
                CCTK_VarTypeI
                CCTK_GroupStaggerDirArrayGI
-               FLAT_BOUNDARY
+               BndUseThreads2
+               BndFaceRows2
+               BndRowsShare2
+               BndCountWork2
    @history
    @hdate      Tue 10 Apr 2001
    @hauthor    Thomas Radke
    @hdesc      Merged separate routines for 1D, 2D, and 3D
                into a single generic routine
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Replaced the FLAT_BOUNDARY macro by a loop over
+               (variable, face, row) work items which is spread over
+               OpenMP threads
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Record the modelled memory traffic and flops of each loop
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Select the row loop by element size once per call and step
+               through the rows of a thread without divisions
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Enter a parallel region only when the loop is threaded, as
+               the serial cost of entering one is that of a small face
    @endhistory
 
    @returntype int
@@ -289,9 +328,10 @@ static int ApplyBndFlat(const cGH *GH, CCTK_INT width_dir,
                         const CCTK_INT *in_widths,
                         int dir, CCTK_INT faces,
                         int first_var, int num_vars) {
-  int i, j, k;
-  int var, vtypesize, gindex, gdim, timelvl;
+  int i, d, f, pass, split;
+  int vtypesize, gindex, gdim, timelvl;
   int doBC[2 * MAXDIM], ash[MAXDIM], lsh[MAXDIM];
+  int extent[2 * MAXDIM][MAXDIM], nrows[2 * MAXDIM];
   CCTK_INT widths[2 * MAXDIM];
   CCTK_INT symtable;
   CCTK_INT symbnd[2 * MAXDIM];
@@ -356,76 +396,65 @@ static int ApplyBndFlat(const cGH *GH, CCTK_INT width_dir,
   /* sanity check on width of boundary,  */
   BndSanityCheckWidths2(GH, first_var, gdim, widths, "Flat");
 
-  /* now loop over all variables */
-  for (var = first_var; var < first_var + num_vars; var++) {
-    /* Apply condition if:
-       + boundary is a physical boundary
-       + boundary is an outer boundary
-       + have enough grid points
-    */
-    for (i = 0; i < 2 * gdim; i++) {
-      doBC[i] = is_physical[i] && (faces == CCTK_ALL_FACES || (faces & (1<<i)));
+  /* Apply condition if:
+     + boundary is a physical boundary
+     + boundary is an outer boundary
+     + have enough grid points
+  */
+  for (i = 0; i < 2 * gdim; i++) {
+    doBC[i] = is_physical[i] && (faces == CCTK_ALL_FACES || (faces & (1<<i)));
+  }
+  for (i = 0; i < gdim; i++) {
+    ash[i] = GH->cctk_ash[i];
+    lsh[i] = GH->cctk_lsh[i];
+    doBC[i * 2] &= GH->cctk_lsh[i] > widths[i * 2] && GH->cctk_bbox[i * 2];
+    doBC[i * 2 + 1] &=
+        GH->cctk_lsh[i] > widths[i * 2 + 1] && GH->cctk_bbox[i * 2 + 1];
+    if (dir != 0) {
+      doBC[i * 2] &= (dir < 0 && (i + 1 == abs(dir)));
+      doBC[i * 2 + 1] &= (dir > 0 && (i + 1 == abs(dir)));
     }
-    for (i = 0; i < gdim; i++) {
-      ash[i] = GH->cctk_ash[i];
-      lsh[i] = GH->cctk_lsh[i];
-      doBC[i * 2] &= GH->cctk_lsh[i] > widths[i * 2] && GH->cctk_bbox[i * 2];
-      doBC[i * 2 + 1] &=
-          GH->cctk_lsh[i] > widths[i * 2 + 1] && GH->cctk_bbox[i * 2 + 1];
-      if (dir != 0) {
-        doBC[i * 2] &= (dir < 0 && (i + 1 == abs(dir)));
-        doBC[i * 2 + 1] &= (dir > 0 && (i + 1 == abs(dir)));
-      }
+  }
+
+  /* the boundary zone of each face is a box of extent[face][] points,
+     which is traversed in rows along the x direction */
+  for (f = 0; f < 2 * gdim; f++) {
+    for (i = 0; i < MAXDIM; i++) {
+      extent[f][i] = lsh[i];
     }
+    extent[f][f / 2] = widths[f];
+    nrows[f] = doBC[f] ? extent[f][1] * extent[f][2] : 0;
+  }
 
-    /* now apply the boundaries face by face */
-    if (gdim > 0) {
+  /* now apply the boundaries direction by direction, since edges and
+     corners are copied from points set by an earlier direction.
+     The lower and upper face of one direction are independent, unless
+     one face's boundary zone contains the points the other copies from. */
+  for (d = 0; d < gdim; d++) {
 #ifdef DEBUG_BOUNDARY
-      if (doBC[0]) {
-        printf("Boundary: Applying lower x flat boundary condition\n");
-      }
-      if (doBC[1]) {
-        printf("Boundary: Applying upper x flat boundary condition\n");
-      }
-#endif /* DEBUG_BOUNDARY */
-      /* lower x */
-      FLAT_BOUNDARY(doBC[0], widths[0], lsh[1], lsh[2], i, j, k, widths[0], j,
-                    k);
-      /* upper x */
-      FLAT_BOUNDARY(doBC[1], widths[1], lsh[1], lsh[2], lsh[0] - i - 1, j, k,
-                    lsh[0] - widths[1] - 1, j, k);
+    if (doBC[2 * d]) {
+      printf("Boundary: Applying lower %c flat boundary condition\n", "xyz"[d]);
     }
-    if (gdim > 1) {
-#ifdef DEBUG_BOUNDARY
-      if (doBC[2]) {
-        printf("Boundary: Applying lower y flat boundary condition\n");
-      }
-      if (doBC[3]) {
-        printf("Boundary: Applying upper y flat boundary condition\n");
-      }
-#endif /* DEBUG_BOUNDARY */
-      /* lower y */
-      FLAT_BOUNDARY(doBC[2], lsh[0], widths[2], lsh[2], i, j, k, i, widths[2],
-                    k);
-      /* upper y */
-      FLAT_BOUNDARY(doBC[3], lsh[0], widths[3], lsh[2], i, lsh[1] - j - 1, k, i,
-                    lsh[1] - widths[3] - 1, k);
+    if (doBC[2 * d + 1]) {
+      printf("Boundary: Applying upper %c flat boundary condition\n", "xyz"[d]);
     }
-    if (gdim > 2) {
-#ifdef DEBUG_BOUNDARY
-      if (doBC[4]) {
-        printf("Boundary: Applying lower z flat boundary condition\n");
-      }
-      if (doBC[5]) {
-        printf("Boundary: Applying upper z flat boundary condition\n");
-      }
 #endif /* DEBUG_BOUNDARY */
-      /* lower z */
-      FLAT_BOUNDARY(doBC[4], lsh[0], lsh[1], widths[4], i, j, k, i, j,
-                    widths[4]);
-      /* upper z */
-      FLAT_BOUNDARY(doBC[5], lsh[0], lsh[1], widths[5], i, j, lsh[2] - k - 1, i,
-                    j, lsh[2] - widths[5] - 1);
+    split = lsh[d] <= widths[2 * d] + widths[2 * d + 1];
+    for (pass = 0; pass <= split; pass++) {
+      const int nlower = split && pass == 1 ? 0 : nrows[2 * d];
+      const int nupper = split && pass == 0 ? 0 : nrows[2 * d + 1];
+      const CCTK_INT npoints =
+          num_vars * (nlower * extent[2 * d][0] +
+                      nupper * extent[2 * d + 1][0]);
+      const BndRows2 rows =
+          BndFaceRows2(num_vars, nlower ? extent[2 * d] : NULL,
+                       nupper ? extent[2 * d + 1] : NULL);
+      const int threaded = BndUseThreads2(npoints);
+
+      /* each point reads its inner neighbour and writes itself */
+      BndCountWork2(npoints, 2 * vtypesize, 0);
+
+      BND_PARALLEL_IF2(threaded, BND_SWITCH_SIZE2(vtypesize, FLAT_ROWS));
     }
   }
 
@@ -0,0 +1,288 @@
+/*@@
+  @file      Fused.cc
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Single-pass application of different local BCs.
+
+             A stage often selects Flat for some variables, Scalar for
+             others and Radiation for the rest, each with the same
+             faces and width.  Instead of one sweep over the boundary
+             per BC, ApplyFused walks the boundary once, row by row,
+             and applies the update each variable was selected for to
+             that row.  Geometry, loop set-up and the coordinates of a
+             row are shared by all variables.  Every variable goes
+             through the same operations in the same order as in its
+             own BC, so the results are bitwise identical.
+  @enddesc
+  @version   $Header$
+@@*/
+
+#include <cstddef>
+#include <vector>
+
+#include "cctk.h"
+#include "cctk_Parameters.h"
+
+#include "Boundary2.h"
+#include "Boundary2_Kernels.hh"
+#include "Fused.h"
+
+namespace Boundary2 {
+
+using namespace Kernels;
+
+enum { FUSED_SCALAR, FUSED_FLAT, FUSED_STATIC, FUSED_RADIATIVE };
+
+/* what one variable of a fused call is updated with */
+struct FusedVar {
+  int kind;
+  ScalarParams scalar;
+  CCTK_REAL limit, speed;
+  /* the time level Static and Radiation read from */
+  int timelevel;
+};
+
+bool IsFusableBC(boundary_function func) {
+  return func == (boundary_function)Bndry_Scalar ||
+         func == (boundary_function)Bndry_Flat ||
+         func == (boundary_function)Bndry_Static ||
+         func == (boundary_function)Bndry_Radiative;
+}
+
+/* read the arguments of a variable as its own BC does */
+static FusedVar FusedSetup(boundary_function func, CCTK_INT var,
+                           CCTK_INT table) {
+  FusedVar fv;
+  fv.limit = 0;
+  fv.speed = 1;
+  fv.timelevel = 0;
+  if (func == (boundary_function)Bndry_Scalar) {
+    fv.kind = FUSED_SCALAR;
+    fv.scalar = ScalarParams(table);
+  } else if (func == (boundary_function)Bndry_Flat) {
+    fv.kind = FUSED_FLAT;
+  } else if (func == (boundary_function)Bndry_Static) {
+    fv.kind = FUSED_STATIC;
+    fv.timelevel = 1;
+  } else {
+    fv.kind = FUSED_RADIATIVE;
+    RadiativeFromTable(table, fv.limit, fv.speed);
+    fv.timelevel = CCTK_DeclaredTimeLevelsVI(var) > 1 ? 1 : 0;
+  }
+  return fv;
+}
+
+/* the update of one point of a variable with a BC of the given kind */
+template <int kind, typename T>
+static inline void FusedPoint(const FusedVar &fv, const RadiativeFace &rf,
+                              T *to, const T *from, const CCTK_REAL *r,
+                              const CCTK_REAL *xyz, Offset inward,
+                              Offset normal) {
+  switch (kind) {
+  case FUSED_SCALAR:
+    ScalarPoint(fv.scalar, to);
+    break;
+  case FUSED_FLAT:
+    FlatPoint(to, to + inward);
+    break;
+  case FUSED_STATIC:
+    StaticPoint(to, from);
+    break;
+  default:
+    *to = RadiativePoint(rf, to, from, r, xyz, normal);
+  }
+}
+
+/**
+ * The row of boundary points of one variable which starts at the
+ * inside-most layer and runs outwards. Rows run along x, except on x
+ * faces, where they run along y and every point is a cache line of its
+ * own; those are applied a few points at a time, with all depths of a
+ * piece before the next, so that the lines stay in cache.
+ */
+template <int kind, typename T>
+static void FusedRow(const cGH *cctkGH, const BndPointwiseGrid &g,
+                     const FusedVar &fv, const RadiativeFace &rf,
+                     CCTK_INT var, int d, int face, int ijk[3], int nx) {
+  const int x_piece = 8;
+  T *to = (T *)cctkGH->data[var][0];
+  const T *from = (const T *)cctkGH->data[var][fv.timelevel];
+  const CCTK_REAL *r = g.xyzr[3], *xyz = g.xyzr[d];
+  const Offset inward = face & 1 ? -g.stride[d] : g.stride[d];
+
+  if (d == 0) {
+    for (int j0 = 0; j0 < nx; j0 += x_piece) {
+      const int j1 = j0 + x_piece < nx ? j0 + x_piece : nx;
+
+      for (int n = g.width[face] - 1; n >= 0; n--) {
+        const Offset start =
+            (face & 1 ? g.lsh[0] - 1 - n : n) + ijk[2] * g.stride[2];
+        for (int j = j0; j < j1; j++) {
+          const Offset o = start + j * g.stride[1];
+          FusedPoint<kind>(fv, rf, to + o, from + o, r + o, xyz + o, inward,
+                           g.stride[d]);
+        }
+      }
+    }
+    return;
+  }
+  for (int n = g.width[face] - 1; n >= 0; n--) {
+    ijk[d] = face & 1 ? g.lsh[d] - 1 - n : n;
+    const Offset start = ijk[1] * g.stride[1] + ijk[2] * g.stride[2];
+#pragma omp simd
+    for (int i = 0; i < nx; i++) {
+      const Offset o = start + i;
+      FusedPoint<kind>(fv, rf, to + o, from + o, r + o, xyz + o, inward,
+                       g.stride[d]);
+    }
+  }
+}
+
+template <typename T>
+static void FusedApply(const cGH *cctkGH, const BndPointwiseGrid &g,
+                       int num_vars, const CCTK_INT *vars,
+                       const std::vector<FusedVar> &fvs) {
+  DECLARE_CCTK_PARAMETERS;
+
+  /* modelled traffic and flops per point, as counted by the BCs */
+  int bytes = 0, flops = 0;
+  for (const FusedVar &fv : fvs) {
+    bytes += fv.kind == FUSED_SCALAR ? sizeof(T)
+             : fv.kind == FUSED_RADIATIVE
+                 ? 3 * sizeof(T) + 2 * sizeof(CCTK_REAL)
+                 : 2 * sizeof(T);
+    flops += fv.kind == FUSED_RADIATIVE ? (radpower > 0 ? 70 : 35) : 0;
+  }
+
+  /* the Courant factors of every face for every variable */
+  std::vector<RadiativeFace> rfs;
+  rfs.reserve(6 * num_vars);
+  for (const FusedVar &fv : fvs) {
+    for (int face = 0; face < 6; face++) {
+      rfs.push_back(
+          RadiativeFace(cctkGH, face, fv.limit, fv.speed, radpower));
+    }
+  }
+
+  for (int d = 0; d < 3; d++) {
+    /* rows run along x, or along y on the x faces */
+    const int nx = d == 0 ? g.lsh[1] : g.lsh[0];
+    const int nrows = g.lsh[0] * g.lsh[1] * g.lsh[2] / (g.lsh[d] * nx);
+    /* lower faces first where the faces can see each other, which is
+       the order of the separate BCs */
+    const int split = g.lsh[d] < g.width[2 * d] + g.width[2 * d + 1] + 2;
+
+    for (int pass = 0; pass <= split; pass++) {
+      const int nlower = g.doBC[2 * d] && !(split && pass == 1) ? nrows : 0;
+      const int nupper =
+          g.doBC[2 * d + 1] && !(split && pass == 0) ? nrows : 0;
+      const int nitems = nlower + nupper;
+      const CCTK_INT npoints =
+          nx * (nlower * g.width[2 * d] + nupper * g.width[2 * d + 1]);
+
+      BndCountWork2(npoints, bytes, flops);
+
+      /* each item is one row of the boundary index space, to which
+         all variables are applied while it is in cache */
+      const auto apply_row = [&](int item) {
+        int row = item;
+        const int face = row < nlower ? 2 * d : 2 * d + 1;
+        int ijk[3] = {0, 0, 0};
+
+        if (face & 1) {
+          row -= nlower;
+        }
+        ijk[d == 2 ? 1 : 2] = row;
+        for (int v = 0; v < num_vars; v++) {
+          const RadiativeFace &rf = rfs[6 * v + face];
+          switch (fvs[v].kind) {
+          case FUSED_SCALAR:
+            FusedRow<FUSED_SCALAR, T>(cctkGH, g, fvs[v], rf, vars[v], d, face,
+                                      ijk, nx);
+            break;
+          case FUSED_FLAT:
+            FusedRow<FUSED_FLAT, T>(cctkGH, g, fvs[v], rf, vars[v], d, face,
+                                    ijk, nx);
+            break;
+          case FUSED_STATIC:
+            FusedRow<FUSED_STATIC, T>(cctkGH, g, fvs[v], rf, vars[v], d, face,
+                                      ijk, nx);
+            break;
+          default:
+            FusedRow<FUSED_RADIATIVE, T>(cctkGH, g, fvs[v], rf, vars[v], d,
+                                         face, ijk, nx);
+          }
+        }
+      };
+
+      if (BndUseThreads2(npoints * num_vars)) {
+#pragma omp parallel for schedule(static)
+        for (int item = 0; item < nitems; item++) {
+          apply_row(item);
+        }
+      } else {
+        for (int item = 0; item < nitems; item++) {
+          apply_row(item);
+        }
+      }
+    }
+  }
+}
+
+CCTK_INT ApplyFused(const cGH *cctkGH, int num_vars, const CCTK_INT *vars,
+                    const boundary_function *funcs, const CCTK_INT *faces,
+                    const CCTK_INT *widths, const CCTK_INT *tables) {
+  bool coords = false;
+  std::vector<FusedVar> fvs;
+  for (int v = 0; v < num_vars; v++) {
+    fvs.push_back(FusedSetup(funcs[v], vars[v], tables[v]));
+    coords |= fvs.back().kind == FUSED_RADIATIVE;
+    /* as Static checks on its own */
+    if (fvs.back().kind == FUSED_STATIC &&
+        CCTK_ActiveTimeLevelsVI(cctkGH, vars[v]) < 2) {
+      CCTK_VWarn(0, __LINE__, __FILE__, CCTK_THORNSTRING,
+                 "Static Boundary condition needs at least two timelevels "
+                 "active, but %s only has %d.",
+                 CCTK_FullName(vars[v]),
+                 CCTK_ActiveTimeLevelsVI(cctkGH, vars[v]));
+    }
+  }
+
+  BndPointwiseGrid g;
+  const int err = BndPointwiseGrid2(cctkGH, vars[0], faces[0], widths[0],
+                                    tables[0], 1, 0, coords, &g);
+  if (err < 0) {
+    return err;
+  }
+
+  switch (g.vtype) {
+  case CCTK_VARIABLE_REAL:
+    FusedApply<CCTK_REAL>(cctkGH, g, num_vars, vars, fvs);
+    break;
+#ifdef HAVE_CCTK_REAL4
+  case CCTK_VARIABLE_REAL4:
+    FusedApply<CCTK_REAL4>(cctkGH, g, num_vars, vars, fvs);
+    break;
+#endif
+#ifdef HAVE_CCTK_REAL8
+  case CCTK_VARIABLE_REAL8:
+    FusedApply<CCTK_REAL8>(cctkGH, g, num_vars, vars, fvs);
+    break;
+#endif
+#ifdef HAVE_CCTK_REAL16
+  case CCTK_VARIABLE_REAL16:
+    FusedApply<CCTK_REAL16>(cctkGH, g, num_vars, vars, fvs);
+    break;
+#endif
+  default:
+    CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+               "Unsupported variable type %d for variable '%s'", g.vtype,
+               CCTK_VarName(vars[0]));
+    return -4;
+  }
+
+  return 0;
+}
+
+} // namespace Boundary2
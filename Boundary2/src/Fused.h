@@ -0,0 +1,42 @@
+/*@@
+  @file      Fused.h
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Single-pass application of different local BCs to the
+             variables of one stage
+  @enddesc
+  @version   $Header$
+@@*/
+
+#ifndef _FUSED_H_
+#define _FUSED_H_
+
+#ifndef __cplusplus
+#error "Fused.h can only be used from C++"
+#endif
+
+#include "cctk.h"
+#include "Boundary2.h"
+
+namespace Boundary2 {
+
+/**
+ * Whether ApplyFused can stand in for calls of func.
+ */
+bool IsFusableBC(boundary_function func);
+
+/**
+ * Apply funcs[v] to vars[v] for all num_vars variables in one
+ * traversal of the boundary. The variables must be 3D grid functions
+ * of one shape, selected with the same faces and a non-negative
+ * width, and every funcs[v] must be fusable. Returns 0 or the last
+ * error of a variable, like the BCs it replaces.
+ */
+CCTK_INT ApplyFused(const cGH *cctkGH, int num_vars, const CCTK_INT *vars,
+                    const boundary_function *funcs, const CCTK_INT *faces,
+                    const CCTK_INT *widths, const CCTK_INT *tables);
+
+} // namespace Boundary2
+
+#endif /* _FUSED_H_ */
@@ -0,0 +1,127 @@
+/*@@
+  @file      Imbalance.cc
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Load imbalance of the boundary conditions between
+             processes.
+
+             Only processes whose components touch the outer boundary
+             do real work in the BCs, and the others wait for them at
+             the next sync.  Every imbalance_every iterations the time
+             each process spent in BCs since the previous report and
+             the number of boundary points it updated are gathered on
+             the root process, which prints their minimum, mean and
+             maximum and the most loaded processes.
+  @enddesc
+  @version   $Header$
+@@*/
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "cctk.h"
+#include "cctk_Arguments.h"
+#include "cctk_Parameters.h"
+
+#ifdef HAVE_CAPABILITY_MPI
+#include <mpi.h>
+#endif
+
+#include "Timers.h"
+
+namespace Boundary2 {
+
+/* the totals at the previous report */
+static double last_seconds = 0, last_points = 0;
+static int last_iteration = 0;
+
+/* min, mean and max of values, and the processes of the extremes */
+static void BndPrintSpread(const char *what, const char *format,
+                           const std::vector<double> &values) {
+  const int min = std::min_element(values.begin(), values.end()) -
+                  values.begin();
+  const int max = std::max_element(values.begin(), values.end()) -
+                  values.begin();
+  double mean = 0;
+  for (double v : values) {
+    mean += v;
+  }
+  mean /= values.size();
+  const std::string line = std::string("  %-7s min ") + format +
+                           " (proc %d), mean " + format + ", max " + format +
+                           " (proc %d), max/mean %.2f";
+  CCTK_VInfo(CCTK_THORNSTRING, line.c_str(), what, values[min], min, mean,
+             values[max], max, mean > 0 ? values[max] / mean : 1.0);
+}
+
+} // namespace Boundary2
+
+/*@@
+   @routine    Boundary2_ReportImbalance
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Gather the BC time and points of all processes since the
+               previous report and print how evenly they are spread
+   @enddesc
+@@*/
+extern "C" void Boundary2_ReportImbalance(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+  DECLARE_CCTK_PARAMETERS;
+  using namespace Boundary2;
+
+  if (imbalance_every <= 0 || cctk_iteration % imbalance_every != 0) {
+    return;
+  }
+
+  double seconds, points;
+  BndTimerTotals(seconds, points);
+  const double local[2] = {seconds - last_seconds, points - last_points};
+  last_seconds = seconds;
+  last_points = points;
+
+  const int nprocs = CCTK_nProcs(cctkGH);
+  const int proc = CCTK_MyProc(cctkGH);
+  std::vector<double> all(2 * nprocs);
+#ifdef HAVE_CAPABILITY_MPI
+  MPI_Gather(const_cast<double *>(local), 2, MPI_DOUBLE, all.data(), 2,
+             MPI_DOUBLE, 0, MPI_COMM_WORLD);
+#else
+  all[0] = local[0];
+  all[1] = local[1];
+#endif
+  const int first_iteration = last_iteration;
+  last_iteration = cctk_iteration;
+  if (proc != 0) {
+    return;
+  }
+
+  std::vector<double> times(nprocs), counts(nprocs);
+  int idle = 0;
+  for (int p = 0; p < nprocs; p++) {
+    times[p] = all[2 * p];
+    counts[p] = all[2 * p + 1];
+    idle += counts[p] == 0;
+  }
+  CCTK_VInfo(CCTK_THORNSTRING,
+             "Boundary load of %d processes in iterations %d to %d "
+             "(%d without boundary points):",
+             nprocs, first_iteration, cctk_iteration, idle);
+  BndPrintSpread("seconds", "%.6f", times);
+  BndPrintSpread("points", "%.0f", counts);
+
+  std::vector<int> order(nprocs);
+  for (int p = 0; p < nprocs; p++) {
+    order[p] = p;
+  }
+  std::stable_sort(order.begin(), order.end(),
+                   [&](int a, int b) { return times[a] > times[b]; });
+  const int nworst = std::min(nprocs, int(imbalance_worst_procs));
+  for (int i = 0; i < nworst; i++) {
+    const int p = order[i];
+    CCTK_VInfo(CCTK_THORNSTRING, "  proc %d: %.6f s, %.0f points", p,
+               times[p], counts[p]);
+  }
+}
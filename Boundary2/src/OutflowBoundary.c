@@ -0,0 +1,544 @@
+/*@@
+  @file      OutflowBoundary.c
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Routines for applying outflow boundary conditions: a flat
+             copy of all variables in which the velocity component
+             normal to a face is not allowed to point into the grid
+  @enddesc
+  @history
+  @hdate
+  @hauthor
+  @hdesc
+  @endhistory
+  @version   $Header$
+@@*/
+
+/*#define DEBUG_BOUNDARY*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cctk.h"
+#include "util_Table.h"
+#include "util_ErrorCodes.h"
+#include "cctk_Parameters.h"
+#include "Boundary2.h"
+
+/* velocity group used if the table does not name one */
+#define DEFAULT_VELOCITY "HydroBase::vel"
+
+static int ApplyBndOutflow(const cGH *GH, const CCTK_INT *in_widths,
+                           CCTK_INT faces, const CCTK_INT *vars,
+                           const int *normal, int num_vars);
+
+/********************************************************************
+ ********************    External Routines   ************************
+ ********************************************************************/
+/*@@
+   @routine    Bndry_Outflow
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Top level function which is registered as handling
+               the Outflow boundary condition
+   @enddesc
+   @calls      ApplyBndOutflow
+
+   @var        GH
+   @vdesc      Pointer to CCTK grid hierarchy
+   @vtype      const cGH *
+   @vio        in
+   @endvar
+   @var        num_vars
+   @vdesc      number of variables passed in through var_indices[]
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @var        var_indices
+   @vdesc      array of variable indicies to which to apply this boundary
+               condition
+   @vtype      CCTK_INT *
+   @vio        in
+   @endvar
+   @var        faces
+   @vdesc      array of set of faces to which to apply the bc
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @var        widths
+   @vdesc      array of boundary widths for each variable
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @var        table_handles
+   @vdesc      array of table handles which hold extra arguments
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @returntype CCTK_INT
+   @returndesc
+               return code of @seeroutine ApplyBndOutflow
+               -13 invalid velocity group in table
+               -21 error reading boundary width array from table
+               -22 wrong size boundary width array in table
+   @endreturndesc
+@@*/
+CCTK_INT Bndry_Outflow(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
+                       CCTK_INT *faces, CCTK_INT *widths, CCTK_INT *tables) {
+  int i, j, k, gi, gdim, max_gdim, err, retval;
+  int first_vel, num_vel;
+  CCTK_INT value_type, value_size;
+  char *velocity_name;
+
+  /* variables to pass to ApplyBndOutflow */
+  CCTK_INT *width_alldirs; /* width of boundary in all directions */
+  int *normal;             /* direction of each velocity component */
+
+  retval = 0;
+  width_alldirs = NULL;
+  max_gdim = 0;
+  normal = (int *)malloc(num_vars * sizeof *normal);
+
+  /* loop through variables, j at a time */
+  for (i = 0; i < num_vars; i += j) {
+    /* find other vars which are selected for identical bcs; unlike for
+       Flat they need not be adjacent, so that the primitives and the
+       velocity are updated in one sweep */
+    j = 1;
+    gi = CCTK_GroupIndexFromVarI(vars[i]);
+    while (i + j < num_vars && BndCanBatchVars2(GH, vars[i], vars[i + j]) &&
+           tables[i + j] == tables[i] && faces[i + j] == faces[i] &&
+           widths[i + j] == widths[i]) {
+      ++j;
+    }
+
+    /* Look on table for the velocity group */
+    velocity_name = NULL;
+    err = Util_TableQueryValueInfo(tables[i], &value_type, &value_size,
+                                   "VELOCITY");
+    if (err == 1) {
+      if (value_type == CCTK_VARIABLE_STRING) {
+        velocity_name = malloc(value_size * sizeof(char));
+        Util_TableGetString(tables[i], value_size, velocity_name, "VELOCITY");
+      } else {
+        CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                   "Invalid data type for key \"VELOCITY\".  Please use "
+                   "CCTK_STRING for the name of the velocity group.");
+        retval = -13;
+        continue;
+      }
+    }
+    first_vel = -1;
+    num_vel = 0;
+    k = CCTK_GroupIndex(velocity_name ? velocity_name : DEFAULT_VELOCITY);
+    if (k >= 0) {
+      first_vel = CCTK_FirstVarIndexI(k);
+      num_vel = CCTK_NumVarsInGroupI(k);
+    } else if (velocity_name) {
+      CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                 "Invalid group \"%s\" given under key \"VELOCITY\" for "
+                 "Outflow boundary conditions on %s",
+                 velocity_name, CCTK_VarName(vars[i]));
+      free(velocity_name);
+      retval = -13;
+      continue;
+    }
+    free(velocity_name);
+
+    /* Determine boundary width on all faces */
+    /* allocate memory for buffer */
+    gdim = CCTK_GroupDimI(gi);
+    if (gdim > max_gdim) {
+      width_alldirs =
+          (CCTK_INT *)realloc(width_alldirs, 2 * gdim * sizeof(CCTK_INT));
+      max_gdim = gdim;
+    }
+
+    /* the components of the velocity are suppressed on the faces
+       normal to their direction */
+    for (k = 0; k < j; k++) {
+      normal[i + k] = vars[i + k] >= first_vel &&
+                              vars[i + k] < first_vel + num_vel &&
+                              vars[i + k] - first_vel < gdim
+                          ? vars[i + k] - first_vel
+                          : -1;
+    }
+
+    /* fill it with values, either from table or the boundary_width
+       parameter */
+    if (widths[i] < 0) {
+      err = Util_TableGetIntArray(tables[i], 2 * gdim, width_alldirs,
+                                  "BOUNDARY_WIDTH");
+      if (err < 0) {
+        CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                   "Error %d when reading boundary width array from table "
+                   "for %s",
+                   err, CCTK_VarName(vars[i]));
+        retval = -21;
+        break;
+      } else if (err != 2 * gdim) {
+        CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                   "Boundary width array for %s has %d elements, but %d "
+                   "expected",
+                   CCTK_VarName(vars[i]), err, 2 * gdim);
+        retval = -22;
+        break;
+      }
+    } else {
+      for (k = 0; k < 2 * gdim; ++k) {
+        width_alldirs[k] = widths[i];
+      }
+    }
+
+    /* Apply the boundary condition */
+    if ((err = ApplyBndOutflow(GH, width_alldirs, faces[i], vars + i,
+                               normal + i, j)) < 0) {
+      CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                 "ApplyBndOutflow() returned %d", err);
+      retval = err;
+    }
+  }
+
+  free(normal);
+  free(width_alldirs);
+
+  return retval;
+}
+
+/********************************************************************
+ *********************     Local Routines   *************************
+ ********************************************************************/
+
+/* maximum dimension we can deal with */
+#define MAXDIM 3
+
+/* macro to compute the linear index of a 3D point */
+#define INDEX_3D(ash, i, j, k) ((i) + (ash)[0] * ((j) + (ash)[1] * (k)))
+
+/*@@
+   @routine    OUTFLOW_ROWS
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Macro to copy the first interior point along the normal
+               into the rows of the boundary zones of both faces of
+               direction d, with the rows shared out among OpenMP
+               threads a plane of rows at a time, as FLAT_ROWS does.
+               In the rows of the velocity component along the normal,
+               values which point into the grid are set to zero.  The
+               sign test is a select rather than a branch, so that the
+               loop vectorizes.
+   @enddesc
+
+   @var        size
+   @vdesc      size of an element in bytes
+   @vtype      int
+   @vio        in
+   @endvar
+   @var        cctk_type
+   @vdesc      CCTK datatype of the velocity components
+   @vtype      <cctk_type>
+   @vio        in
+   @endvar
+@@*/
+#define OUTFLOW_ROWS(size, cctk_type)                                          \
+  {                                                                            \
+    BndRow2 _row;                                                              \
+    int _n = BndRowsShare2(&rows, threaded, &_row);                            \
+                                                                               \
+    while (_n > 0) {                                                           \
+      const int _face = 2 * d + _row.upper;                                    \
+      const int _nrows = _n < BND_PLANE_ROWS2(rows, _row)                      \
+                             ? _n : BND_PLANE_ROWS2(rows, _row);               \
+      /* rows of x faces run along the normal, so the interior point is        \
+         the same for a whole row of an x face and a whole plane of a y        \
+         face */                                                               \
+      const int _from_step = d == 0 ? 0 : 1;                                   \
+      const ptrdiff_t _from_stride = d == 1 ? 0 : ash[0];                      \
+      const int _nx = extent[_face][0];                                        \
+      const cctk_type _sign = _row.upper ? -1 : 1;                             \
+      int _to[MAXDIM], _from[MAXDIM], _jj, _ii;                                \
+      char *_data, *_to_row;                                                   \
+      const char *_from_row;                                                   \
+                                                                               \
+      _to[0] = 0;                                                              \
+      _to[1] = _row.j;                                                         \
+      _to[2] = _row.k;                                                         \
+      _from[0] = _to[0];                                                       \
+      _from[1] = _to[1];                                                       \
+      _from[2] = _to[2];                                                       \
+      /* the order of the points does not matter, so the zone of an upper      \
+         face is traversed outwards like that of a lower one */                \
+      if (_row.upper) {                                                        \
+        _to[d] += lsh[d] - widths[_face];                                      \
+        _from[d] = lsh[d] - widths[_face] - 1;                                 \
+      } else {                                                                 \
+        _from[d] = widths[_face];                                              \
+      }                                                                        \
+      _data = (char *)GH->data[vars[_row.var]][timelvl];                       \
+      _to_row = _data + INDEX_3D(ash, _to[0], _to[1], _to[2]) * (size);        \
+      _from_row =                                                              \
+          _data + INDEX_3D(ash, _from[0], _from[1], _from[2]) * (size);        \
+      for (_jj = 0; _jj < _nrows; _jj++) {                                     \
+        if (normal[_row.var] == d) {                                           \
+          cctk_type *_to_v = (cctk_type *)_to_row;                             \
+          const cctk_type *_from_v = (const cctk_type *)_from_row;             \
+                                                                               \
+          for (_ii = 0; _ii < _nx; _ii++) {                                    \
+            const cctk_type _v = _from_v[_ii * _from_step];                    \
+            _to_v[_ii] = _sign * _v > 0 ? 0 : _v;                              \
+          }                                                                    \
+        } else {                                                               \
+          for (_ii = 0; _ii < _nx; _ii++) {                                    \
+            memcpy(_to_row + _ii * (size),                                     \
+                   _from_row + _ii * _from_step * (size), (size));             \
+          }                                                                    \
+        }                                                                      \
+        _to_row += ash[0] * (size);                                            \
+        _from_row += _from_stride * (size);                                    \
+      }                                                                        \
+      _n -= _nrows;                                                            \
+      BND_NEXT_PLANE2(rows, _row);                                             \
+    }                                                                          \
+  }
+
+/* variables of other types than real ones have no velocity components,
+   which ApplyBndOutflow checks, so the type given here is never used */
+#define OUTFLOW_COPY_ROWS(size) OUTFLOW_ROWS(size, CCTK_REAL)
+
+/*@@
+   @routine    ApplyBndOutflow
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Apply outflow boundary conditions to a list of grid
+               functions of one shape given by their indices.
+
+               All variables are copied from the first interior point
+               along the normal of a face, as by ApplyBndFlat, whose
+               (variable, face, row) work items are used here.  For the
+               velocity component along the normal of a face the copy
+               and the suppression of inflow happen in the same row
+               loop, so the boundary is traversed once for all
+               variables.
+   @enddesc
+
+   @var        GH
+   @vdesc      Pointer to CCTK grid hierarchy
+   @vtype      const cGH *
+   @vio        in
+   @endvar
+   @var        in_widths
+   @vdesc      boundary widths for all directions
+   @vtype      CCTK_INT [ dimension of variable(s) ]
+   @vio        in
+   @endvar
+   @var        faces
+   @vdesc      set of faces to which to apply the bc
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @var        vars
+   @vdesc      indices of the variables
+   @vtype      const CCTK_INT *
+   @vio        in
+   @endvar
+   @var        normal
+   @vdesc      for each variable, the direction of the velocity
+               component it holds, or -1 for other variables
+   @vtype      const int *
+   @vio        in
+   @endvar
+   @var        num_vars
+   @vdesc      number of variables
+   @vtype      int
+   @vio        in
+   @endvar
+
+   @calls      CCTK_GroupIndexFromVarI
+               CCTK_GroupDimI
+               CCTK_VarTypeI
+               BndUseThreads2
+               BndFaceRows2
+               BndRowsShare2
+               BndCountWork2
+
+   @returntype int
+   @returndesc
+                0 for success
+               -1 if dimension is not supported
+               -4 if the type of a velocity component is not supported
+   @endreturndesc
+@@*/
+static int ApplyBndOutflow(const cGH *GH, const CCTK_INT *in_widths,
+                           CCTK_INT faces, const CCTK_INT *vars,
+                           const int *normal, int num_vars) {
+  int i, d, f, v, pass, split;
+  int vtype, vtypesize, gindex, gdim, timelvl;
+  int doBC[2 * MAXDIM], ash[MAXDIM], lsh[MAXDIM];
+  int extent[2 * MAXDIM][MAXDIM], nrows[2 * MAXDIM];
+  CCTK_INT widths[2 * MAXDIM];
+  CCTK_INT symtable;
+  CCTK_INT symbnd[2 * MAXDIM];
+  CCTK_INT is_physical[2 * MAXDIM];
+  CCTK_INT ierr;
+
+  /* get the group index of the variables */
+  gindex = CCTK_GroupIndexFromVarI(vars[0]);
+
+  /* get the number of dimensions and the size of the variables' type */
+  gdim = CCTK_GroupDimI(gindex);
+  vtype = CCTK_VarTypeI(vars[0]);
+  vtypesize = CCTK_VarTypeSize(vtype);
+
+  /* make sure we can deal with this number of dimensions */
+  if (gdim > MAXDIM) {
+    CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+               "ApplyBndOutflow: Variable dimension of %d not supported",
+               gdim);
+    return (-1);
+  }
+
+  /* the velocity components are compared with zero */
+  for (v = 0; v < num_vars; v++) {
+    if (normal[v] < 0) {
+      continue;
+    }
+    switch (CCTK_VarTypeI(vars[v])) {
+    case CCTK_VARIABLE_REAL:
+#ifdef HAVE_CCTK_REAL4
+    case CCTK_VARIABLE_REAL4:
+#endif
+#ifdef HAVE_CCTK_REAL8
+    case CCTK_VARIABLE_REAL8:
+#endif
+#ifdef HAVE_CCTK_REAL16
+    case CCTK_VARIABLE_REAL16:
+#endif
+      break;
+    default:
+      CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                 "Unsupported variable type %d for velocity component '%s'",
+                 CCTK_VarTypeI(vars[v]), CCTK_VarName(vars[v]));
+      return (-4);
+    }
+  }
+
+  memcpy(widths, in_widths, 2 * gdim * sizeof *widths);
+
+  /* initialize arrays for variables with less dimensions than MAXDIM
+     so that we can use the INDEX_3D macro later on */
+  for (i = gdim; i < MAXDIM; i++) {
+    ash[i] = 1;
+    lsh[i] = 1;
+  }
+
+  /* get the current timelevel */
+  timelvl = 0;
+
+  /* see if we have a physical boundary */
+  symtable = SymmetryTableHandleForGrid(GH);
+  if (symtable < 0)
+    CCTK_WARN(0, "internal error");
+  ierr = Util_TableGetIntArray(symtable, 2 * gdim, symbnd, "symmetry_handle");
+  if (ierr != 2 * gdim)
+    CCTK_WARN(0, "internal error");
+  for (i = 0; i < 2 * gdim; i++) {
+    is_physical[i] = symbnd[i] < 0;
+  }
+
+  /* sanity check on width of boundary,  */
+  BndSanityCheckWidths2(GH, vars[0], gdim, widths, "Outflow");
+
+  /* Apply condition if:
+     + boundary is a physical boundary
+     + boundary is an outer boundary
+     + have enough grid points
+  */
+  for (i = 0; i < 2 * gdim; i++) {
+    doBC[i] = is_physical[i] && (faces == CCTK_ALL_FACES || (faces & (1<<i)));
+  }
+  for (i = 0; i < gdim; i++) {
+    ash[i] = GH->cctk_ash[i];
+    lsh[i] = GH->cctk_lsh[i];
+    doBC[i * 2] &= GH->cctk_lsh[i] > widths[i * 2] && GH->cctk_bbox[i * 2];
+    doBC[i * 2 + 1] &=
+        GH->cctk_lsh[i] > widths[i * 2 + 1] && GH->cctk_bbox[i * 2 + 1];
+  }
+
+  /* the boundary zone of each face is a box of extent[face][] points,
+     which is traversed in rows along the x direction */
+  for (f = 0; f < 2 * gdim; f++) {
+    for (i = 0; i < MAXDIM; i++) {
+      extent[f][i] = lsh[i];
+    }
+    extent[f][f / 2] = widths[f];
+    nrows[f] = doBC[f] ? extent[f][1] * extent[f][2] : 0;
+  }
+
+  /* now apply the boundaries direction by direction, since edges and
+     corners are copied from points set by an earlier direction.
+     The lower and upper face of one direction are independent, unless
+     one face's boundary zone contains the points the other copies from. */
+  for (d = 0; d < gdim; d++) {
+#ifdef DEBUG_BOUNDARY
+    if (doBC[2 * d]) {
+      printf("Boundary: Applying lower %c outflow boundary condition\n",
+             "xyz"[d]);
+    }
+    if (doBC[2 * d + 1]) {
+      printf("Boundary: Applying upper %c outflow boundary condition\n",
+             "xyz"[d]);
+    }
+#endif /* DEBUG_BOUNDARY */
+    split = lsh[d] <= widths[2 * d] + widths[2 * d + 1];
+    for (pass = 0; pass <= split; pass++) {
+      const int nlower = split && pass == 1 ? 0 : nrows[2 * d];
+      const int nupper = split && pass == 0 ? 0 : nrows[2 * d + 1];
+      const CCTK_INT npoints =
+          num_vars * (nlower * extent[2 * d][0] +
+                      nupper * extent[2 * d + 1][0]);
+      const BndRows2 rows =
+          BndFaceRows2(num_vars, nlower ? extent[2 * d] : NULL,
+                       nupper ? extent[2 * d + 1] : NULL);
+      const int threaded = BndUseThreads2(npoints);
+
+      /* each point reads its inner neighbour and writes itself */
+      BndCountWork2(npoints, 2 * vtypesize, 0);
+
+      switch (vtype) {
+      case CCTK_VARIABLE_REAL:
+        BND_PARALLEL_IF2(threaded,
+                         OUTFLOW_ROWS(sizeof(CCTK_REAL), CCTK_REAL));
+        break;
+#ifdef HAVE_CCTK_REAL4
+      case CCTK_VARIABLE_REAL4:
+        BND_PARALLEL_IF2(threaded,
+                         OUTFLOW_ROWS(sizeof(CCTK_REAL4), CCTK_REAL4));
+        break;
+#endif
+#ifdef HAVE_CCTK_REAL8
+      case CCTK_VARIABLE_REAL8:
+        BND_PARALLEL_IF2(threaded,
+                         OUTFLOW_ROWS(sizeof(CCTK_REAL8), CCTK_REAL8));
+        break;
+#endif
+#ifdef HAVE_CCTK_REAL16
+      case CCTK_VARIABLE_REAL16:
+        BND_PARALLEL_IF2(threaded,
+                         OUTFLOW_ROWS(sizeof(CCTK_REAL16), CCTK_REAL16));
+        break;
+#endif
+      default:
+        BND_PARALLEL_IF2(threaded,
+                         BND_SWITCH_SIZE2(vtypesize, OUTFLOW_COPY_ROWS));
+        break;
+      }
+    }
+  }
+
+  return (0);
+}
@@ -0,0 +1,202 @@
+/*@@
+  @file      PerfCounters.cc
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Hardware performance counters around the boundary
+             conditions applied by the task engine.
+
+             With perf_counters set, every call of a BC function made
+             by the engine reads the Linux perf_event counters for
+             cycles, instructions, last level cache misses and data
+             TLB misses of the calling thread before and after the
+             call.  The differences are accumulated per BC and set of
+             faces and printed at termination.  Only user space events
+             are counted, so that this works with the default
+             perf_event_paranoid setting.  Work which a kernel spreads
+             over OpenMP threads is not counted; set use_openmp = no
+             for complete counts.
+  @enddesc
+  @version   $Header$
+@@*/
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+#include "cctk.h"
+#include "cctk_Arguments.h"
+#include "cctk_Parameters.h"
+
+#include "PerfCounters.h"
+#include "Timers.h"
+
+namespace Boundary2 {
+
+static const char *const perf_names[BND_PERF_NCOUNTERS] = {
+    "cycles", "instructions", "LLC misses", "dTLB misses"};
+
+#ifdef __linux__
+
+static const struct {
+  __u32 type;
+  __u64 config;
+} perf_events[BND_PERF_NCOUNTERS] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL |
+                             (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                             (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+    {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB |
+                             (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                             (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+};
+
+/* the counters which could not be opened and were warned about */
+static std::atomic<int> perf_warned(0);
+
+/* the counters of one thread, opened on first use */
+struct BndPerfThread {
+  bool opened = false;
+  int fds[BND_PERF_NCOUNTERS];
+
+  void Open() {
+    opened = true;
+    for (int i = 0; i < BND_PERF_NCOUNTERS; i++) {
+      struct perf_event_attr attr;
+      memset(&attr, 0, sizeof attr);
+      attr.size = sizeof attr;
+      attr.type = perf_events[i].type;
+      attr.config = perf_events[i].config;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      fds[i] = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+      if (fds[i] < 0 && !(perf_warned.fetch_or(1 << i) & (1 << i))) {
+        CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                   "Cannot open the %s counter: %s", perf_names[i],
+                   strerror(errno));
+      }
+    }
+  }
+
+  ~BndPerfThread() {
+    if (opened) {
+      for (int i = 0; i < BND_PERF_NCOUNTERS; i++) {
+        if (fds[i] >= 0) {
+          close(fds[i]);
+        }
+      }
+    }
+  }
+};
+
+static thread_local BndPerfThread perf_thread;
+
+bool BndPerfRead(long long counts[BND_PERF_NCOUNTERS]) {
+  if (!perf_thread.opened) {
+    perf_thread.Open();
+  }
+  bool any = false;
+  for (int i = 0; i < BND_PERF_NCOUNTERS; i++) {
+    unsigned long long value;
+    if (perf_thread.fds[i] >= 0 &&
+        read(perf_thread.fds[i], &value, sizeof value) == sizeof value) {
+      counts[i] = value;
+      any = true;
+    } else {
+      counts[i] = -1;
+    }
+  }
+  return any;
+}
+
+#else
+
+bool BndPerfRead(long long counts[BND_PERF_NCOUNTERS]) {
+  static bool warned = false;
+  if (!warned) {
+    warned = true;
+    CCTK_WARN(1, "Hardware performance counters are only supported on Linux");
+  }
+  for (int i = 0; i < BND_PERF_NCOUNTERS; i++) {
+    counts[i] = -1;
+  }
+  return false;
+}
+
+#endif
+
+struct BndPerfAcc {
+  long calls;
+  long long counts[BND_PERF_NCOUNTERS];
+};
+
+static std::mutex perf_mutex;
+static std::map<std::pair<std::string, CCTK_INT>, BndPerfAcc> perf_accs;
+
+void BndPerfAdd(const std::string &bc_name, CCTK_INT faces,
+                const long long start[BND_PERF_NCOUNTERS],
+                const long long end[BND_PERF_NCOUNTERS]) {
+  std::lock_guard<std::mutex> lock(perf_mutex);
+  BndPerfAcc &acc = perf_accs[std::make_pair(bc_name, faces)];
+  acc.calls++;
+  for (int i = 0; i < BND_PERF_NCOUNTERS; i++) {
+    if (start[i] < 0 || end[i] < 0 || acc.counts[i] < 0) {
+      acc.counts[i] = -1;
+    } else {
+      acc.counts[i] += end[i] - start[i];
+    }
+  }
+}
+
+} // namespace Boundary2
+
+/*@@
+   @routine    Boundary2_ReportPerfCounters
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Print the hardware counters accumulated per BC and set
+               of faces
+   @enddesc
+@@*/
+extern "C" void Boundary2_ReportPerfCounters(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_PARAMETERS;
+  using namespace Boundary2;
+
+  if (!perf_counters) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(perf_mutex);
+  CCTK_VInfo(CCTK_THORNSTRING,
+             "Hardware counters in boundary conditions (user space, "
+             "calling threads)");
+  CCTK_VInfo(CCTK_THORNSTRING, "%12s  %-18s %10s %14s %14s %6s %12s %12s",
+             "bc", "faces", "calls", perf_names[BND_PERF_CYCLES],
+             perf_names[BND_PERF_INSTRUCTIONS], "IPC",
+             perf_names[BND_PERF_LLC_MISSES],
+             perf_names[BND_PERF_DTLB_MISSES]);
+  for (const auto &kv : perf_accs) {
+    const long long *c = kv.second.counts;
+    const double ipc = c[BND_PERF_CYCLES] > 0 && c[BND_PERF_INSTRUCTIONS] >= 0
+                           ? double(c[BND_PERF_INSTRUCTIONS]) /
+                                 c[BND_PERF_CYCLES]
+                           : -1;
+    CCTK_VInfo(CCTK_THORNSTRING,
+               "%12s  %-18s %10ld %14lld %14lld %6.2f %12lld %12lld",
+               kv.first.first.c_str(), BndFacesName(kv.first.second).c_str(),
+               kv.second.calls, c[BND_PERF_CYCLES], c[BND_PERF_INSTRUCTIONS],
+               ipc, c[BND_PERF_LLC_MISSES], c[BND_PERF_DTLB_MISSES]);
+  }
+}
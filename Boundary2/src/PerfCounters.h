@@ -0,0 +1,50 @@
+/*@@
+  @file      PerfCounters.h
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Hardware performance counters around the boundary
+             conditions applied by the task engine
+  @enddesc
+  @version   $Header$
+@@*/
+
+#ifndef _PERFCOUNTERS_H_
+#define _PERFCOUNTERS_H_
+
+#ifndef __cplusplus
+#error "PerfCounters.h can only be used from C++"
+#endif
+
+#include <string>
+
+#include "cctk.h"
+
+namespace Boundary2 {
+
+enum {
+  BND_PERF_CYCLES,
+  BND_PERF_INSTRUCTIONS,
+  BND_PERF_LLC_MISSES,
+  BND_PERF_DTLB_MISSES,
+  BND_PERF_NCOUNTERS
+};
+
+/**
+ * Reads the counters of the calling thread, opening them on its first
+ * call. Counters which cannot be opened read as -1. Returns false if
+ * none is available.
+ */
+bool BndPerfRead(long long counts[BND_PERF_NCOUNTERS]);
+
+/**
+ * Adds the counts between start and end to the accumulator of a BC
+ * and set of faces. Safe to use from several threads at once.
+ */
+void BndPerfAdd(const std::string &bc_name, CCTK_INT faces,
+                const long long start[BND_PERF_NCOUNTERS],
+                const long long end[BND_PERF_NCOUNTERS]);
+
+} // namespace Boundary2
+
+#endif /* _PERFCOUNTERS_H_ */
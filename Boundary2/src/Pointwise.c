@@ -0,0 +1,226 @@
+/*@@
+  @file      Pointwise.c
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Grid set-up for boundary conditions registered as pointwise
+             functors through Boundary2_Pointwise.hh.  Everything which
+             does not depend on the functor (boundary widths, physical
+             faces, coordinates and time levels) is collected here, the
+             loops themselves are instantiated in the registering thorn.
+  @enddesc
+  @history
+  @hdate
+  @hauthor
+  @hdesc
+  @endhistory
+  @version   $Header$
+@@*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cctk.h"
+#include "util_Table.h"
+#include "util_ErrorCodes.h"
+#include "cctk_Functions.h"
+#include "Boundary2.h"
+
+/* maximum dimension we can deal with */
+#define MAXDIM 3
+
+/********************************************************************
+ ********************* Externally visible helpers *******************
+ ********************************************************************/
+
+/*@@
+   @routine    BndPointwiseGrid2
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Describes the boundary zones which a pointwise boundary
+               condition updates for a variable: the local shape and
+               strides, the width of every face, which faces are
+               physical outer boundaries with enough points for the
+               interior points the functor reads, and, if requested,
+               the Cartesian coordinates and the radius.  Dimensions
+               beyond the variable's are set up with one point, so that
+               callers can always loop in three dimensions.
+   @enddesc
+   @calls      CCTK_GroupDimFromVarI
+               Util_TableGetIntArray
+               BndSanityCheckWidths2
+               SymmetryTableHandleForGrid
+               CCTK_CoordIndex
+
+   @var        GH
+   @vdesc      Pointer to CCTK grid hierarchy
+   @vtype      const cGH *
+   @vio        in
+   @endvar
+   @var        var
+   @vdesc      index of the variable, or of the first of variables
+               batched by BndCanBatchVars2, which share its shape and
+               its number of active time levels
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @var        faces
+   @vdesc      set of faces the variable was selected for
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @var        width
+   @vdesc      boundary width, or negative to read BOUNDARY_WIDTH from
+               the table
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @var        table
+   @vdesc      table handle of the selection
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @var        interior_points
+   @vdesc      number of points inside a boundary point along the normal
+               which the functor reads
+   @vtype      int
+   @vio        in
+   @endvar
+   @var        past_timelevels
+   @vdesc      number of past time levels the functor reads
+   @vtype      int
+   @vio        in
+   @endvar
+   @var        needs_coordinates
+   @vdesc      whether the functor reads coordinates
+   @vtype      int
+   @vio        in
+   @endvar
+   @var        grid
+   @vdesc      the description of the boundary zones
+   @vtype      BndPointwiseGrid *
+   @vio        out
+   @endvar
+
+   @returntype int
+   @returndesc
+                0 for success
+               -2 if variable dimension is not supported
+               -4 if the variable has too few active time levels
+               -6 if a coordinate is not found
+               -21 error reading boundary width array from table
+               -22 wrong size boundary width array in table
+   @endreturndesc
+@@*/
+int BndPointwiseGrid2(const cGH *GH, CCTK_INT var, CCTK_INT faces,
+                      CCTK_INT width, CCTK_INT table, int interior_points,
+                      int past_timelevels, int needs_coordinates,
+                      BndPointwiseGrid *grid) {
+  int i, gdim, err, indx;
+  char coord_system_name[20];
+  CCTK_INT symtable;
+  CCTK_INT symbnd[2 * MAXDIM];
+
+  gdim = CCTK_GroupDimFromVarI(var);
+  if (gdim > MAXDIM) {
+    CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+               "BndPointwiseGrid2: variable dimension of %d not supported",
+               gdim);
+    return (-2);
+  }
+
+  /* set up boundary width array, either from the table or the width
+     argument */
+  if (width < 0) {
+    err = Util_TableGetIntArray(table, 2 * gdim, grid->width,
+                                "BOUNDARY_WIDTH");
+    if (err < 0) {
+      CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                 "Error %d when reading boundary width array from table "
+                 "for %s",
+                 err, CCTK_VarName(var));
+      return (-21);
+    } else if (err != 2 * gdim) {
+      CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                 "Boundary width array for %s has %d elements, but %d "
+                 "expected",
+                 CCTK_VarName(var), err, 2 * gdim);
+      return (-22);
+    }
+  } else {
+    for (i = 0; i < 2 * gdim; i++) {
+      grid->width[i] = width;
+    }
+  }
+  BndSanityCheckWidths2(GH, var, gdim, grid->width, "Pointwise");
+
+  if (CCTK_ActiveTimeLevelsVI(GH, var) <= past_timelevels) {
+    CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+               "Boundary condition needs %d past time levels, but %s "
+               "only has %d active time levels",
+               past_timelevels, CCTK_VarName(var),
+               CCTK_ActiveTimeLevelsVI(GH, var));
+    return (-4);
+  }
+
+  /* see if we have a physical boundary */
+  symtable = SymmetryTableHandleForGrid(GH);
+  if (symtable < 0)
+    CCTK_WARN(0, "internal error");
+  err = Util_TableGetIntArray(symtable, 2 * gdim, symbnd, "symmetry_handle");
+  if (err != 2 * gdim)
+    CCTK_WARN(0, "internal error");
+
+  grid->dim = gdim;
+  for (i = 0; i < MAXDIM; i++) {
+    grid->lsh[i] = i < gdim ? GH->cctk_lsh[i] : 1;
+    grid->stride[i] = i == 0 ? 1 : grid->stride[i - 1] * GH->cctk_ash[i - 1];
+    grid->delta[i] =
+        i < gdim ? GH->cctk_delta_space[i] / GH->cctk_levfac[i] : 0;
+    grid->xyzr[i] = NULL;
+  }
+  grid->xyzr[MAXDIM] = NULL;
+  grid->vtype = CCTK_VarTypeI(var);
+
+  /* Apply condition if:
+     + boundary is a physical boundary
+     + boundary is an outer boundary
+     + have enough grid points for the boundary and the interior points
+       read from it
+  */
+  for (i = 0; i < 2 * MAXDIM; i++) {
+    if (i >= 2 * gdim) {
+      grid->width[i] = 0;
+      grid->doBC[i] = 0;
+      continue;
+    }
+    grid->doBC[i] = symbnd[i] < 0 &&
+                    (faces == CCTK_ALL_FACES || (faces & (1 << i))) &&
+                    GH->cctk_bbox[i] &&
+                    GH->cctk_lsh[i / 2] >= grid->width[i] + interior_points;
+  }
+
+  if (needs_coordinates) {
+    for (i = 0; i < gdim; i++) {
+      snprintf(coord_system_name, sizeof(coord_system_name), "cart%dd", gdim);
+      indx = CCTK_CoordIndex(i + 1, NULL, coord_system_name);
+      if (indx < 0) {
+        CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                   "Coordinate for system %s not found", coord_system_name);
+        return (-6);
+      }
+      grid->xyzr[i] = GH->data[indx][0];
+    }
+    snprintf(coord_system_name, sizeof(coord_system_name), "spher%dd", gdim);
+    indx = CCTK_CoordIndex(-1, "r", coord_system_name);
+    if (indx < 0) {
+      CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                 "Coordinate for system %s not found", coord_system_name);
+      return (-6);
+    }
+    grid->xyzr[MAXDIM] = GH->data[indx][0];
+  }
+
+  return (0);
+}
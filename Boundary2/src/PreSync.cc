@@ -5,10 +5,20 @@
 #include <cctk.h>
 #include <cctk_Arguments.h>
 #include <cctk_Parameters.h>
+#include <cctk_Functions.h>
 #include <math.h>
+#include <algorithm>
 #include <array>
 #include <iostream>
+#include <sstream>
+#include <util_Table.h>
 #include "PreSync.h"
+#include "Boundary2.h"
+#include "TaskPool.h"
+#include "Timers.h"
+#include "Capture.h"
+#include "Trace.h"
+#include "Fused.h"
 
 namespace Carpet {
 
@@ -47,12 +57,24 @@ std::map<std::string,SymFunc> symmetry_functions;
  */
 std::array<std::map<int,std::vector<Bound>>,2> boundary_conditions;
 
+/**
+ * Incremented whenever a registration or selection changes, so that
+ * cached application plans can be recognized as stale.
+ */
+static unsigned long selection_generation = 0;
+
+/**
+ * Register a physical BC to be applied before (before != 0) or after
+ * (before == 0) the ghost zones are exchanged. BCs applied before the
+ * exchange may only read points owned by the component; the exchange
+ * then fills in the ghost zones, including their boundary points.
+ */
 extern "C"
-CCTK_INT Bdry2_Boundary_RegisterPhysicalBC(
+CCTK_INT Bdry2_Boundary_RegisterPhysicalBCPhase(
     const cGH *cctkGH,
     boundary_function func,
-    const char *bc_name) {
-    int before = 1;
+    const char *bc_name,
+    CCTK_INT before) {
   if(before != 0) before = 1;
   if(NULL==func) {
     CCTK_VError(__LINE__, __FILE__, CCTK_THORNSTRING,  
@@ -61,9 +83,56 @@ CCTK_INT Bdry2_Boundary_RegisterPhysicalBC(
   Func& f = boundary_functions[bc_name];
   f.func = func;
   f.before = before;
+  selection_generation++;
   return 0;
 }
 
+/**
+ * BCs registered without a phase keep being applied before the ghost
+ * zone exchange, where they have always been.
+ */
+extern "C"
+CCTK_INT Bdry2_Boundary_RegisterPhysicalBC(
+    const cGH *cctkGH,
+    boundary_function func,
+    const char *bc_name) {
+  return Bdry2_Boundary_RegisterPhysicalBCPhase(cctkGH,func,bc_name,1);
+}
+
+/**
+ * What the engine knows about a BC registered as a pointwise functor:
+ * whether it only touches the variable it is applied to (plus
+ * coordinates and past time levels), and how many values it reads per
+ * boundary point.
+ */
+struct BndPointwiseTraits {
+  bool pure;
+  int points_read;
+};
+
+static std::map<boundary_function,BndPointwiseTraits> bnd_pointwise;
+
+/**
+ * Register a BC generated by Boundary2::RegisterPointwiseBC. Pure BCs
+ * are handled like the BCs of this thorn: they are applied before the
+ * ghost zone exchange if local_bcs_before_sync is set, concurrently
+ * with other runs, and batched across groups and tables.
+ */
+extern "C"
+CCTK_INT Bdry2_Boundary_RegisterPointwiseBC(
+    const cGH *cctkGH,
+    boundary_function func,
+    const char *bc_name,
+    CCTK_INT pure,
+    CCTK_INT points_read) {
+  DECLARE_CCTK_PARAMETERS;
+  BndPointwiseTraits& t = bnd_pointwise[func];
+  t.pure = pure != 0;
+  t.points_read = points_read;
+  return Bdry2_Boundary_RegisterPhysicalBCPhase(cctkGH,func,bc_name,
+                                                t.pure && local_bcs_before_sync);
+}
+
 extern "C"
 void Bdry2_Boundary_RegisterSymmetryBC(
     const cGH *cctkGH,
@@ -84,18 +153,20 @@ void Bdry2_Boundary_RegisterSymmetryBC(
 //  std::cout << "Register Width of " << f.width[0] << " for " << bc_name << std::endl;
 }
 
-void Boundary_SelectVarForBCI(
-    const cGH *cctkGH,
-    int faces,
-    int width,
-    int table_handle,
-    int var_index,
-    const char *bc_name) {
+static Func& BndFindBC(const char *bc_name) {
   if(!boundary_functions.count(bc_name)) {
     CCTK_VError(__LINE__, __FILE__, CCTK_THORNSTRING,  
                "Requested BC '%s' not found.", bc_name);
   }
-  Func& f = boundary_functions.at(bc_name);
+  return boundary_functions.at(bc_name);
+}
+
+/**
+ * Add a selection of a variable for the BC f, without invalidating the
+ * cached plans; the callers do that once for all variables they select.
+ */
+static void BndAddSelection(const Func& f,int faces,int width,int table_handle,
+                            int var_index,const char *bc_name) {
   CCTK_ASSERT(var_index != 0);
   std::vector<Bound>& bv = boundary_conditions[f.before][var_index];
   Bound b;
@@ -106,6 +177,18 @@ void Boundary_SelectVarForBCI(
   bv.push_back(b);
 }
 
+void Boundary_SelectVarForBCI(
+    const cGH *cctkGH,
+    int faces,
+    int width,
+    int table_handle,
+    int var_index,
+    const char *bc_name) {
+  const Func& f = BndFindBC(bc_name);
+  BndAddSelection(f,faces,width,table_handle,var_index,bc_name);
+  selection_generation++;
+}
+
 extern "C"
 void Bdry2_Boundary_SelectVarForBC(
     const cGH *cctkGH,
@@ -135,6 +218,42 @@ CCTK_INT Bdry2_Boundary_SelectGroupForBC(
   return 0;
 }
 
+/**
+ * Select all variables of num_groups groups, given by their indices,
+ * for one BC with the same faces, width and table. The BC is looked up
+ * once and the cached plans are invalidated once, so that thorns can
+ * select all their groups with a single call per substep. Nothing is
+ * selected if any of the group indices is invalid.
+ */
+extern "C"
+CCTK_INT Bdry2_Boundary_SelectGroupsForBCI(
+    const cGH *cctkGH,
+    CCTK_INT faces,
+    CCTK_INT width,
+    CCTK_INT table_handle,
+    CCTK_INT num_groups,
+    const CCTK_INT *group_indices,
+    const char *bc_name) {
+  const Func& f = BndFindBC(bc_name);
+  for(int g=0;g<num_groups;g++) {
+    if(group_indices[g] < 0 || group_indices[g] >= CCTK_NumGroups()) {
+      CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                 "Invalid group index %d selected for BC '%s'",
+                 int(group_indices[g]), bc_name);
+      return -1;
+    }
+  }
+  for(int g=0;g<num_groups;g++) {
+    const int vstart = CCTK_FirstVarIndexI(group_indices[g]);
+    const int vnum = CCTK_NumVarsInGroupI(group_indices[g]);
+    for(int i=vstart;i<vstart+vnum;i++) {
+      BndAddSelection(f,faces,width,table_handle,i,bc_name);
+    }
+  }
+  selection_generation++;
+  return 0;
+}
+
 extern "C"
 void Boundary_ClearBCForVarI(
     const cGH *cctkGH,
@@ -142,6 +261,1038 @@ void Boundary_ClearBCForVarI(
   CCTK_ASSERT(var_index != 0);
   boundary_conditions[0][var_index].resize(0);
   boundary_conditions[1][var_index].resize(0);
+  selection_generation++;
+}
+
+/**
+ * A run of consecutive variables of one group which are selected for
+ * the same BC with identical faces, width and table, i.e. what a
+ * single call of the BC function handles in one go.
+ */
+struct BndRun {
+  std::string bc_name;
+  boundary_function func;
+  bool parallel;
+  std::vector<CCTK_INT> vars, faces, widths, tables;
+  /** why the previous run of the stage could not be continued */
+  int broken_by;
+  /** the BC of each variable if several runs were fused into this one
+      (see BndFuseRuns), empty otherwise */
+  std::vector<boundary_function> funcs;
+  /** the name of the BC of each variable of a fused run, to which its
+      time is attributed (see BndTimer) */
+  std::vector<std::string> bc_names;
+  /** the number of runs fused into this one */
+  int nfused;
+};
+
+/**
+ * Why a run ended before the next variable of its stage, in the order
+ * in which BndBuildPlan checks: a different BC, a variable in between
+ * which is not selected in this stage, a group of another shape or
+ * staggering (or any other group, for BCs which cannot batch across
+ * groups), faces, width or table.
+ */
+enum {
+  BND_BREAK_FIRST,
+  BND_BREAK_BC,
+  BND_BREAK_GAP,
+  BND_BREAK_GROUP,
+  BND_BREAK_FACES,
+  BND_BREAK_WIDTH,
+  BND_BREAK_TABLE,
+  BND_NBREAKS
+};
+
+static const char *const bnd_break_names[BND_NBREAKS] = {
+  "first", "other BC", "gap", "group", "faces", "width", "table"};
+
+/**
+ * Batching statistics of the BC calls since the last report (see
+ * report_batching): calls of BC functions, the variables they were
+ * given, the runs, what ended them, the runs which were cut into
+ * several calls for the task pool, and the runs which were fused into
+ * another run.
+ */
+struct BndBatchStats {
+  long calls, vars, runs, split_runs, fused_runs;
+  long breaks[BND_NBREAKS];
+};
+
+static BndBatchStats bnd_batch_stats;
+
+/**
+ * The runs to apply for one phase. stages[s] holds the runs for the
+ * s-th BC selected for each variable; stages are applied in order.
+ * Plans are cached per phase and variable list until a registration
+ * or selection changes. Runs across groups compare the active time
+ * levels when the plan is built; the kernels compare them again for
+ * the variables they batch.
+ */
+struct BndPlan {
+  std::vector<std::vector<BndRun>> stages;
+};
+
+static std::map<std::pair<int,std::vector<int>>,BndPlan> bnd_plans;
+
+/**
+ * The BCs of this thorn only touch the variables they are applied to
+ * (plus coordinates), so runs of them may be applied concurrently, as
+ * may runs of pure pointwise BCs. Anything else, including Copy which
+ * reads another variable, is applied serially after them.
+ */
+static bool BndIsPurePointwise(boundary_function func) {
+  const auto t = bnd_pointwise.find(func);
+  return t != bnd_pointwise.end() && t->second.pure;
+}
+
+static bool BndIsParallelSafe(boundary_function func) {
+  return BndIsPurePointwise(func) ||
+         func == (boundary_function)Bndry_Scalar ||
+         func == (boundary_function)Bndry_Flat ||
+         func == (boundary_function)Bndry_Radiative ||
+         func == (boundary_function)Bndry_Robin ||
+         func == (boundary_function)Bndry_Static ||
+         func == (boundary_function)Bndry_Extrapolate ||
+         func == (boundary_function)Bndry_Outflow ||
+         func == (boundary_function)Bndry_None;
+}
+
+/**
+ * The kernels of this thorn which hand variables of different groups
+ * with the same shape to one loop (see BndCanBatchVars2). Copy is not
+ * among them since it reads the source variables relative to the first
+ * one, and BCs of other thorns may expect a single group unless they
+ * are pointwise BCs, whose loops split runs by shape themselves.
+ */
+static bool BndBatchesAcrossGroups(boundary_function func) {
+  return func != (boundary_function)Bndry_Copy && BndIsParallelSafe(func);
+}
+
+/**
+ * BCs which take any list of variables of one shape, so that a run of
+ * them continues past variables in between which are selected for
+ * other BCs of the stage: Outflow, which updates the primitives and
+ * the velocity of a fluid in one sweep.
+ */
+static bool BndBatchesAcrossGaps(boundary_function func) {
+  return func == (boundary_function)Bndry_Outflow;
+}
+
+/**
+ * The kernels of this thorn, and the pointwise BCs, which read their
+ * parameters from the table of every variable, so that variables with different tables stay in
+ * one run as long as the width is not taken from the table.
+ */
+static bool BndReadsTablePerVar(boundary_function func) {
+  return BndIsPurePointwise(func) ||
+         func == (boundary_function)Bndry_Scalar ||
+         func == (boundary_function)Bndry_Radiative ||
+         func == (boundary_function)Bndry_Robin;
+}
+
+/**
+ * Relative cost of one boundary point, used to balance the tasks.
+ */
+static double BndCostPerPoint(boundary_function func) {
+  if(func == (boundary_function)Bndry_None) return 0;
+  if(func == (boundary_function)Bndry_Radiative) return 8;
+  if(func == (boundary_function)Bndry_Robin) return 4;
+  if(func == (boundary_function)Bndry_Extrapolate) return 2;
+  const auto t = bnd_pointwise.find(func);
+  if(t != bnd_pointwise.end()) return 0.5*(1 + t->second.points_read);
+  return 1;
+}
+
+static double BndRunCostPerPoint(const BndRun& r) {
+  if(r.funcs.empty()) return BndCostPerPoint(r.func);
+  double cost = 0;
+  for(boundary_function func : r.funcs) cost += BndCostPerPoint(func);
+  return cost / r.funcs.size();
+}
+
+/**
+ * Estimate of the number of points a BC updates on this component.
+ */
+static CCTK_INT BndBoundaryPoints(const cGH *cctkGH, int var, int faces, int width) {
+  const int dim = std::min(CCTK_GroupDimFromVarI(var), cctkGH->cctk_dim);
+  CCTK_INT npoints = 0;
+  for(int f=0;f<2*dim;f++) {
+    if(faces != CCTK_ALL_FACES && !(faces & (1 << f))) continue;
+    if(!cctkGH->cctk_bbox[f]) continue;
+    CCTK_INT n = width;
+    for(int d=0;d<dim;d++) {
+      if(d != f/2) n *= cctkGH->cctk_lsh[d];
+    }
+    npoints += n;
+  }
+  return npoints;
+}
+
+/**
+ * With report_batching, name the variables between which a run of one
+ * BC within a group ended, once per BC and variable, since such breaks
+ * usually come from selections which could be merged.
+ */
+static void BndReportBreak(const BndRun& r,int var,int broken_by) {
+  DECLARE_CCTK_PARAMETERS;
+  static std::set<std::pair<std::string,int>> reported;
+  const int last = r.vars.back();
+  if(!report_batching || broken_by == BND_BREAK_BC || broken_by == BND_BREAK_GROUP ||
+     CCTK_GroupIndexFromVarI(last) != CCTK_GroupIndexFromVarI(var) ||
+     !reported.insert(std::make_pair(r.bc_name,var)).second) return;
+  char *last_name = CCTK_FullName(last);
+  char *var_name = CCTK_FullName(var);
+  CCTK_VInfo(CCTK_THORNSTRING,
+             "BC '%s' cannot batch %s with %s of the same group: %s",
+             r.bc_name.c_str(), var_name, last_name,
+             broken_by == BND_BREAK_GAP ? "variables in between are not selected for it" :
+             broken_by == BND_BREAK_FACES ? "they are selected for different faces" :
+             broken_by == BND_BREAK_WIDTH ? "they are selected with different widths" :
+             "they are selected with different table handles");
+  free(last_name);
+  free(var_name);
+}
+
+/**
+ * Whether a run may be fused with other runs of its stage: runs of the
+ * local BCs which ApplyFused implements, on 3D real grid functions with
+ * a width given in the selection.
+ */
+static bool BndIsFusable(const BndRun& r) {
+  DECLARE_CCTK_PARAMETERS;
+  if(!fuse_local_bcs || capture_calls) return false;
+  if(!r.funcs.empty()) return true;
+  const int var = r.vars[0];
+  const int vtype = CCTK_VarTypeI(var);
+  return Boundary2::IsFusableBC(r.func) && r.widths[0] >= 0 &&
+         CCTK_GroupTypeI(CCTK_GroupIndexFromVarI(var)) == CCTK_GF &&
+         CCTK_GroupDimFromVarI(var) == 3 &&
+         (vtype == CCTK_VARIABLE_REAL || vtype == CCTK_VARIABLE_REAL4 ||
+          vtype == CCTK_VARIABLE_REAL8 || vtype == CCTK_VARIABLE_REAL16) &&
+         (r.func != (boundary_function)Bndry_Static ||
+          CCTK_DeclaredTimeLevelsVI(var) > 1);
+}
+
+/**
+ * Merge the fusable runs of a stage which have the same faces and width
+ * and variables of one shape into a single run, which ApplyFused
+ * applies in one traversal of the boundary. The runs of a stage touch
+ * different variables, so the order in which they are applied does
+ * not matter.
+ */
+static void BndFuseRuns(const cGH *cctkGH,std::vector<BndRun>& runs) {
+  std::vector<BndRun> fused;
+  for(BndRun& r : runs) {
+    auto it = fused.end();
+    if(BndIsFusable(r)) {
+      it = std::find_if(fused.begin(),fused.end(),[&](const BndRun& f) {
+        return BndIsFusable(f) && f.faces[0] == r.faces[0] &&
+               f.widths[0] == r.widths[0] && BndCanBatchVars2(cctkGH,f.vars[0],r.vars[0]);
+      });
+    }
+    if(it == fused.end()) {
+      fused.push_back(r);
+      continue;
+    }
+    BndRun& f = *it;
+    if(f.funcs.empty()) {
+      f.funcs.assign(f.vars.size(),f.func);
+      f.bc_names.assign(f.vars.size(),f.bc_name);
+      f.bc_name = "fused";
+    }
+    f.funcs.insert(f.funcs.end(),r.vars.size(),r.func);
+    f.bc_names.insert(f.bc_names.end(),r.vars.size(),r.bc_name);
+    f.vars.insert(f.vars.end(),r.vars.begin(),r.vars.end());
+    f.faces.insert(f.faces.end(),r.faces.begin(),r.faces.end());
+    f.widths.insert(f.widths.end(),r.widths.begin(),r.widths.end());
+    f.tables.insert(f.tables.end(),r.tables.begin(),r.tables.end());
+    f.nfused++;
+  }
+  runs.swap(fused);
+}
+
+static void BndBuildPlan(const cGH *cctkGH,BndPlan& plan,int before,const std::vector<int>& vars) {
+  plan.stages.clear();
+  for(int var : vars) {
+    auto it = boundary_conditions[before].find(var);
+    if(it == boundary_conditions[before].end()) continue;
+    const std::vector<Bound>& bv = it->second;
+    if(plan.stages.size() < bv.size()) plan.stages.resize(bv.size());
+    for(size_t s=0;s<bv.size();s++) {
+      const Bound& b = bv[s];
+      const Func& f = boundary_functions.at(b.bc_name);
+      std::vector<BndRun>& runs = plan.stages[s];
+      int broken_by = BND_BREAK_FIRST;
+      if(runs.size() > 0) {
+        auto rit = runs.rbegin();
+        if(BndBatchesAcrossGaps(f.func)) {
+          /* continue the latest run of the BC in this stage */
+          rit = std::find_if(runs.rbegin(),runs.rend(),
+                             [&](const BndRun& o) { return o.func == f.func; });
+          if(rit == runs.rend()) rit = runs.rbegin();
+        }
+        BndRun& r = *rit;
+        const int last = r.vars.back();
+        broken_by =
+          r.func != f.func ? BND_BREAK_BC :
+          last+1 != var && !BndBatchesAcrossGaps(r.func) ? BND_BREAK_GAP :
+          (BndBatchesAcrossGroups(r.func) ? !BndCanBatchVars2(cctkGH,last,var) :
+           CCTK_GroupIndexFromVarI(last) != CCTK_GroupIndexFromVarI(var)) ? BND_BREAK_GROUP :
+          r.faces.back() != b.faces ? BND_BREAK_FACES :
+          r.widths.back() != b.width ? BND_BREAK_WIDTH :
+          (r.tables.back() != b.table_handle &&
+           !(BndReadsTablePerVar(r.func) && b.width >= 0)) ? BND_BREAK_TABLE : BND_NBREAKS;
+        if(broken_by == BND_NBREAKS) {
+          r.vars.push_back(var);
+          r.faces.push_back(b.faces);
+          r.widths.push_back(b.width);
+          r.tables.push_back(b.table_handle);
+          continue;
+        }
+        BndReportBreak(r,var,broken_by);
+      }
+      BndRun r;
+      r.broken_by = broken_by;
+      r.nfused = 0;
+      r.bc_name = b.bc_name;
+      r.func = f.func;
+      r.parallel = BndIsParallelSafe(f.func);
+      r.vars.push_back(var);
+      r.faces.push_back(b.faces);
+      r.widths.push_back(b.width);
+      r.tables.push_back(b.table_handle);
+      runs.push_back(r);
+    }
+  }
+  for(std::vector<BndRun>& runs : plan.stages) BndFuseRuns(cctkGH,runs);
+}
+
+static BndPlan& BndGetPlan(const cGH *cctkGH,int before,const std::vector<int>& vars) {
+  static unsigned long plans_generation = 0;
+  if(plans_generation != selection_generation) {
+    bnd_plans.clear();
+    plans_generation = selection_generation;
+  }
+  auto it = bnd_plans.find(std::make_pair(before,vars));
+  if(it == bnd_plans.end()) {
+    /* with skip_clean_vars the variable lists vary from sync to sync;
+       no plan is in use here, so the cache may simply be dropped */
+    if(bnd_plans.size() > 1024) bnd_plans.clear();
+    it = bnd_plans.insert(std::make_pair(std::make_pair(before,vars),BndPlan())).first;
+    BndBuildPlan(cctkGH,it->second,before,vars);
+  }
+  return it->second;
+}
+
+/**
+ * Call the BC of a run for n of its variables from the v-th on.
+ */
+static CCTK_INT BndCallRun(const cGH *cctkGH,BndRun& r,int v,int n,CCTK_INT *faces) {
+  if(!r.funcs.empty())
+    return Boundary2::ApplyFused(cctkGH,n,&r.vars[v],&r.funcs[v],faces,
+                                 &r.widths[v],&r.tables[v]);
+  return r.func(cctkGH,n,&r.vars[v],faces,&r.widths[v],&r.tables[v]);
+}
+
+static CCTK_INT BndCheckError(const BndRun& r,CCTK_INT ierr) {
+  if(ierr < 0) {
+    CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+               "Boundary condition '%s' returned %d for variable '%s'",
+               r.bc_name.c_str(), int(ierr), CCTK_VarName(r.vars[0]));
+  }
+  return ierr;
+}
+
+/**
+ * The tasks of one stage of a plan: runs which may be applied
+ * concurrently are cut into tasks of similar cost, the others are
+ * applied in order once the tasks are done (see BndFinishStage).
+ * Tasks are grouped into waves which are run one after the other:
+ * a BC which is split per face handles one direction per wave, since
+ * the faces of a later direction overwrite edges and corners of the
+ * earlier ones.
+ */
+struct BndStageTasks {
+  std::vector<std::vector<Boundary2::BndTask>> waves;
+  std::vector<std::vector<const BndRun*>> wave_runs;
+  int nthreads;
+};
+
+/**
+ * The BCs of this thorn which treat each face on its own, so that
+ * applying them to one face at a time, direction by direction, gives
+ * the same result as applying them to all faces at once. Robin mixes
+ * directions at edges and corners and is never split.
+ */
+static bool BndIsFaceSplittable(const cGH *cctkGH,const BndRun& r) {
+  return (!r.funcs.empty() ||
+          r.func == (boundary_function)Bndry_Scalar ||
+          r.func == (boundary_function)Bndry_Flat ||
+          r.func == (boundary_function)Bndry_Radiative ||
+          r.func == (boundary_function)Bndry_Static ||
+          r.func == (boundary_function)Bndry_Extrapolate ||
+          r.func == (boundary_function)Bndry_Outflow) &&
+         CCTK_GroupDimFromVarI(r.vars[0]) == cctkGH->cctk_dim;
+}
+
+/**
+ * Largest boundary width of a run on any face, or -1 if unknown.
+ */
+static int BndMaxWidth(const cGH *cctkGH,const BndRun& r) {
+  const int dim = cctkGH->cctk_dim;
+  if(r.tables[0] >= 0) {
+    CCTK_INT w[6];
+    if(dim <= 3 && Util_TableGetIntArray(r.tables[0],2*dim,w,"BOUNDARY_WIDTH") == 2*dim)
+      return *std::max_element(w,w+2*dim);
+  }
+  return r.widths[0];
+}
+
+static void BndAddTasks(const cGH *cctkGH,BndStageTasks& st,size_t wave,
+                        BndRun& r,CCTK_INT faces,double target_cost) {
+  if(st.waves.size() <= wave) {
+    st.waves.resize(wave+1);
+    st.wave_runs.resize(wave+1);
+  }
+  const double var_cost = BndRunCostPerPoint(r) *
+      BndBoundaryPoints(cctkGH,r.vars[0],faces,r.widths[0]);
+  const int nvars = r.vars.size();
+  int chunk = nvars;
+  if(var_cost > 0 && target_cost > 0)
+    chunk = std::max(1, std::min(nvars, int(target_cost / var_cost)));
+  for(int v=0;v<nvars;v+=chunk) {
+    const int n = std::min(chunk, nvars-v);
+    bnd_batch_stats.calls++;
+    bnd_batch_stats.vars += n;
+    std::vector<CCTK_INT> task_faces(n,faces);
+    Boundary2::BndTask t;
+    t.run = [cctkGH,&r,v,n,task_faces]() mutable {
+      Boundary2::BndCapture capture(cctkGH,r.bc_name,n,&r.vars[v],task_faces.data(),
+                                    &r.widths[v],&r.tables[v]);
+      Boundary2::BndTimer timer(cctkGH,r.bc_name,&r.vars[v],n,task_faces[0],
+                                r.bc_names.empty() ? nullptr : &r.bc_names[v]);
+      return capture.Done(BndCallRun(cctkGH,r,v,n,task_faces.data()));
+    };
+    t.cost = var_cost * n;
+    t.retval = 0;
+    st.waves[wave].push_back(t);
+    st.wave_runs[wave].push_back(&r);
+  }
+}
+
+/**
+ * Add the tasks of a run to the stage, one per direction and face if
+ * the BC can be split that way.
+ */
+static void BndAddRunTasks(const cGH *cctkGH,BndStageTasks& st,BndRun& r,double target_cost) {
+  if(st.nthreads <= 1 || !BndIsFaceSplittable(cctkGH,r)) {
+    BndAddTasks(cctkGH,st,0,r,r.faces[0],target_cost);
+    return;
+  }
+  /* one wave per direction with selected outer faces; faces which
+     are filled by the sync or by a symmetry are left out, and the
+     lower and upper face get a task each unless they touch */
+  const int width = BndMaxWidth(cctkGH,r);
+  size_t wave = 0;
+  for(int d=0;d<cctkGH->cctk_dim;d++) {
+    CCTK_INT mask[2];
+    for(int s=0;s<2;s++) {
+      const int f = 2*d+s;
+      const bool selected = r.faces[0] == CCTK_ALL_FACES || (r.faces[0] & (1 << f));
+      mask[s] = selected && cctkGH->cctk_bbox[f] ? 1 << f : 0;
+    }
+    if(!mask[0] && !mask[1]) continue;
+    if(mask[0] && mask[1] &&
+       (width < 0 || cctkGH->cctk_lsh[d] <= 2*width+2)) {
+      BndAddTasks(cctkGH,st,wave,r,mask[0] | mask[1],target_cost);
+    } else {
+      for(int s=0;s<2;s++) {
+        if(mask[s]) BndAddTasks(cctkGH,st,wave,r,mask[s],target_cost);
+      }
+    }
+    wave++;
+  }
+}
+
+static void BndMakeTasks(const cGH *cctkGH,std::vector<BndRun>& runs,BndStageTasks& st) {
+  DECLARE_CCTK_PARAMETERS;
+  const int nthreads = use_task_pool ? Boundary2::TaskPoolThreads() : 1;
+
+  double total_cost = 0;
+  CCTK_INT total_points = 0;
+  for(const BndRun& r : runs) {
+    if(!r.parallel) continue;
+    const CCTK_INT npoints = BndBoundaryPoints(cctkGH,r.vars[0],r.faces[0],r.widths[0]);
+    total_cost += npoints * BndRunCostPerPoint(r) * r.vars.size();
+    total_points += npoints * r.vars.size();
+  }
+
+  /* aim for a few tasks per thread so that stealing can even out the
+     errors of the cost estimate */
+  const double target_cost = total_cost / (4 * nthreads);
+  st.nthreads = total_points >= omp_min_points ? nthreads : 1;
+  /* captured data must not change under a call while it is recorded */
+  if(capture_calls && capture_data) st.nthreads = 1;
+  st.waves.clear();
+  st.wave_runs.clear();
+  for(const BndRun& r : runs) {
+    bnd_batch_stats.runs++;
+    bnd_batch_stats.breaks[r.broken_by]++;
+    bnd_batch_stats.fused_runs += r.nfused;
+  }
+  for(BndRun& r : runs) {
+    if(!r.parallel) continue;
+    const long calls = bnd_batch_stats.calls;
+    BndAddRunTasks(cctkGH,st,r,target_cost);
+    if(bnd_batch_stats.calls - calls > 1) bnd_batch_stats.split_runs++;
+  }
+}
+
+static CCTK_INT BndFinishStage(const cGH *cctkGH,std::vector<BndRun>& runs,BndStageTasks& st) {
+  CCTK_INT retval = 0;
+  for(size_t w=0;w<st.waves.size();w++) {
+    for(size_t t=0;t<st.waves[w].size();t++) {
+      if(BndCheckError(*st.wave_runs[w][t],st.waves[w][t].retval) < 0 && retval == 0)
+        retval = st.waves[w][t].retval;
+    }
+  }
+  for(BndRun& r : runs) {
+    if(r.parallel) continue;
+    CCTK_INT ierr;
+    bnd_batch_stats.calls++;
+    bnd_batch_stats.vars += r.vars.size();
+    {
+      Boundary2::BndCapture capture(cctkGH,r.bc_name,r.vars.size(),r.vars.data(),
+                                    r.faces.data(),r.widths.data(),r.tables.data());
+      Boundary2::BndTimer timer(cctkGH,r.bc_name,r.vars.data(),r.vars.size(),r.faces[0],
+                                r.bc_names.empty() ? nullptr : r.bc_names.data());
+      ierr = capture.Done(BndCallRun(cctkGH,r,0,r.vars.size(),r.faces.data()));
+    }
+    if(BndCheckError(r,ierr) < 0 && retval == 0) retval = ierr;
+  }
+  return retval;
+}
+
+/**
+ * Run the waves of a stage from the given one on.
+ */
+static void BndRunWaves(BndStageTasks& st,size_t first) {
+  for(size_t w=first;w<st.waves.size();w++) {
+    Boundary2::RunTasks(st.waves[w],st.nthreads);
+  }
+}
+
+static CCTK_INT BndApplyStage(const cGH *cctkGH,std::vector<BndRun>& runs) {
+  BndStageTasks st;
+  BndMakeTasks(cctkGH,runs,st);
+  BndRunWaves(st,0);
+  return BndFinishStage(cctkGH,runs,st);
+}
+
+static std::vector<int> BndVarList(CCTK_INT num_vars,const CCTK_INT *var_indices) {
+  std::vector<int> vars;
+  if(num_vars < 0 || NULL==var_indices) {
+    for(int b=0;b<2;b++) {
+      for(auto& vb : boundary_conditions[b]) {
+        if(vb.second.size() > 0) vars.push_back(vb.first);
+      }
+    }
+  } else {
+    vars.assign(var_indices,var_indices+num_vars);
+  }
+  std::sort(vars.begin(),vars.end());
+  vars.erase(std::unique(vars.begin(),vars.end()),vars.end());
+  return vars;
+}
+
+/**
+ * Dirty tracking (see Boundary_MarkVarsWritten). bnd_written holds,
+ * per refinement level and variable, the generation of the last write
+ * declared for it. bnd_applied holds, per component, phase and
+ * variable, the write generation its boundaries were last computed
+ * from. Variables which were never marked written are always applied.
+ */
+static unsigned long write_generation = 0;
+static std::map<std::pair<int,int>,unsigned long> bnd_written;
+static std::map<std::vector<int>,std::map<std::pair<int,int>,unsigned long>> bnd_applied;
+
+static std::vector<int> BndComponentKey(const cGH *cctkGH) {
+  std::vector<int> key(1,cctkGH->cctk_levfac[0]);
+  for(int d=0;d<cctkGH->cctk_dim;d++) {
+    key.push_back(cctkGH->cctk_lbnd[d]);
+    key.push_back(cctkGH->cctk_lsh[d]);
+  }
+  return key;
+}
+
+/**
+ * The variables of the list whose boundaries in the given phase may
+ * be stale on the current component.
+ */
+static std::vector<int> BndDirtyVars(const cGH *cctkGH,int before,const std::vector<int>& vars) {
+  DECLARE_CCTK_PARAMETERS;
+  static unsigned long applied_generation = 0;
+  if(applied_generation != selection_generation) {
+    bnd_applied.clear();
+    applied_generation = selection_generation;
+  }
+  if(!skip_clean_vars) return vars;
+  auto ait = bnd_applied.find(BndComponentKey(cctkGH));
+  if(ait == bnd_applied.end()) return vars;
+  std::vector<int> dirty;
+  for(int var : vars) {
+    auto wit = bnd_written.find(std::make_pair(cctkGH->cctk_levfac[0],var));
+    auto vit = ait->second.find(std::make_pair(before,var));
+    if(wit == bnd_written.end() || vit == ait->second.end() ||
+       vit->second != wit->second)
+      dirty.push_back(var);
+  }
+  return dirty;
+}
+
+/**
+ * Remember that the boundaries of the given phase are up to date for
+ * these variables on the current component.
+ */
+static void BndMarkApplied(const cGH *cctkGH,int before,const std::vector<int>& vars) {
+  DECLARE_CCTK_PARAMETERS;
+  if(!skip_clean_vars) return;
+  /* components come and go with regridding; forgetting them all now
+     and then only costs one extra application each */
+  if(bnd_applied.size() > 4096) bnd_applied.clear();
+  std::map<std::pair<int,int>,unsigned long>& applied = bnd_applied[BndComponentKey(cctkGH)];
+  for(int var : vars) {
+    auto wit = bnd_written.find(std::make_pair(cctkGH->cctk_levfac[0],var));
+    if(wit != bnd_written.end()) applied[std::make_pair(before,var)] = wit->second;
+  }
+}
+
+/**
+ * Declare that the given variables were written on the current
+ * refinement level, e.g. by a routine whose schedule declares them as
+ * written. A negative num_vars or a NULL var_indices means all
+ * selected variables. With skip_clean_vars, only variables marked
+ * since their boundaries were last applied on a component get them
+ * applied again. Returns 0.
+ */
+extern "C"
+CCTK_INT Bdry2_Boundary_MarkVarsWritten(
+    const cGH *cctkGH,
+    CCTK_INT num_vars,
+    const CCTK_INT *var_indices) {
+  write_generation++;
+  for(int var : BndVarList(num_vars,var_indices)) {
+    bnd_written[std::make_pair(cctkGH->cctk_levfac[0],var)] = write_generation;
+  }
+  return 0;
+}
+
+/**
+ * Estimate how long applying all selected physical BCs takes on a
+ * component with the given local shape and outer boundary faces
+ * (bbox, as cctk_bbox), e.g. for a load balancer which wants to give
+ * components with expensive boundaries smaller interiors. Faces with a
+ * symmetry are skipped. The time per boundary point of a BC is taken
+ * from the timers if cost_from_timers is set and the BC was timed on
+ * some points, otherwise from cost_seconds_per_point weighted with the
+ * relative cost of the BC. Returns the estimate in seconds, or a
+ * negative value if dim is out of range.
+ */
+extern "C"
+CCTK_REAL Bdry2_Boundary_EstimateComponentCost(
+    const cGH *cctkGH,
+    CCTK_INT dim,
+    const CCTK_INT *lsh,
+    const CCTK_INT *bbox) {
+  DECLARE_CCTK_PARAMETERS;
+  if(dim < 0 || dim > 3) return -1;
+
+  CCTK_INT symbnd[6];
+  const int symtable = SymmetryTableHandleForGrid(cctkGH);
+  if(symtable < 0 ||
+     Util_TableGetIntArray(symtable,2*dim,symbnd,"symmetry_handle") != 2*dim) {
+    for(int f=0;f<2*dim;f++) symbnd[f] = -1;
+  }
+
+  std::map<std::string,double> seconds_per_point;
+  double cost = 0;
+  for(int b=0;b<2;b++) {
+    for(auto& vb : boundary_conditions[b]) {
+      const int vdim = std::min(CCTK_GroupDimFromVarI(vb.first),int(dim));
+      for(const Bound& bnd : vb.second) {
+        auto sit = seconds_per_point.find(bnd.bc_name);
+        if(sit == seconds_per_point.end()) {
+          const Func& f = boundary_functions.at(bnd.bc_name);
+          double seconds;
+          if(!cost_from_timers || !Boundary2::BndSecondsPerPoint(bnd.bc_name,seconds))
+            seconds = cost_seconds_per_point * BndCostPerPoint(f.func);
+          sit = seconds_per_point.insert(std::make_pair(bnd.bc_name,seconds)).first;
+        }
+        CCTK_INT widths[6];
+        if(bnd.table_handle < 0 ||
+           Util_TableGetIntArray(bnd.table_handle,2*vdim,widths,"BOUNDARY_WIDTH") != 2*vdim) {
+          for(int f=0;f<2*vdim;f++) widths[f] = bnd.width;
+        }
+        double npoints = 0;
+        for(int f=0;f<2*vdim;f++) {
+          if(bnd.faces != CCTK_ALL_FACES && !(bnd.faces & (1 << f))) continue;
+          if(!bbox[f] || symbnd[f] >= 0) continue;
+          double n = widths[f];
+          for(int d=0;d<vdim;d++) {
+            if(d != f/2) n *= lsh[d];
+          }
+          npoints += n;
+        }
+        cost += npoints * sit->second;
+      }
+    }
+  }
+  return cost;
+}
+
+/**
+ * With report_batching, print and reset the batching statistics of
+ * the BC calls made since the last report.
+ */
+static void BndReportBatching(const cGH *cctkGH,const char *what) {
+  DECLARE_CCTK_PARAMETERS;
+  BndBatchStats& bs = bnd_batch_stats;
+  if(report_batching && bs.calls > 0) {
+    std::ostringstream breaks;
+    for(int b=BND_BREAK_BC;b<BND_NBREAKS;b++) {
+      breaks << (b == BND_BREAK_BC ? "" : ", ") << bnd_break_names[b] << " " << bs.breaks[b];
+    }
+    CCTK_VInfo(CCTK_THORNSTRING,
+               "Batching of %s on level %d: %ld BC calls for %ld variables "
+               "(%.1f per call) in %ld runs (%ld split into several calls, "
+               "%ld more fused into them); runs ended by %s",
+               what, int(cctkGH->cctk_levfac[0]), bs.calls, bs.vars,
+               double(bs.vars) / bs.calls, bs.runs, bs.split_runs, bs.fused_runs,
+               breaks.str().c_str());
+  }
+  bs = BndBatchStats();
+}
+
+/**
+ * State of BCs applied in the background, by
+ * Boundary_ApplyPhysicalBCsAsync (handle > 0) or
+ * Boundary_StartPhysicalBCsBeforeSync (handle 0). The plans are copied,
+ * since the cached ones may be rebuilt meanwhile, and applied phase by
+ * phase, stage by stage and wave by wave by the driver, a task which a
+ * thread of the pool runs while the caller goes on. Runs which cannot
+ * be tasks are left to the thread calling BndProgress, which then
+ * starts the driver again for the remaining stages. The phases which
+ * succeeded are marked applied by that thread too, when they are
+ * finished, as the caller may mark variables written meanwhile.
+ */
+struct BndPending {
+  const cGH *cctkGH;
+  CCTK_INT handle;
+  const char *what;
+  std::vector<int> phases;
+  std::vector<std::vector<int>> vars;
+  std::vector<BndPlan> plans;
+  size_t phase, stage, wave;
+  BndStageTasks st;
+  std::vector<Boundary2::BndTask> driver;
+  std::vector<size_t> applied;
+  bool running, done;
+  CCTK_INT phase_retval, retval;
+  double started;
+};
+
+static BndPending *bnd_pending = NULL;
+static CCTK_INT bnd_last_handle = 0;
+
+/**
+ * Make the tasks of the next stage of the pending BCs, finishing the
+ * phases passed on the way, or mark them done after the last phase.
+ */
+static void BndNextStage(BndPending& p) {
+  while(p.phase < p.plans.size()) {
+    if(p.stage < p.plans[p.phase].stages.size()) {
+      BndMakeTasks(p.cctkGH,p.plans[p.phase].stages[p.stage],p.st);
+      p.wave = 0;
+      return;
+    }
+    if(p.phase_retval == 0) p.applied.push_back(p.phase);
+    else if(p.retval == 0) p.retval = p.phase_retval;
+    p.phase_retval = 0;
+    p.phase++;
+    p.stage = 0;
+  }
+  p.done = true;
+}
+
+/**
+ * Whether the stage has runs which cannot be tasks, and which only the
+ * thread that started the BCs may apply.
+ */
+static bool BndHasSerialRuns(const std::vector<BndRun>& runs) {
+  for(const BndRun& r : runs) {
+    if(!r.parallel) return true;
+  }
+  return false;
+}
+
+/**
+ * Apply the pending BCs stage by stage until they are done, or, in
+ * the background, until a stage has runs which only the thread that
+ * started them may apply; its waves are run, the rest is left.
+ */
+static void BndAdvance(BndPending& p,bool background) {
+  while(!p.done) {
+    BndRunWaves(p.st,p.wave);
+    p.wave = p.st.waves.size();
+    std::vector<BndRun>& runs = p.plans[p.phase].stages[p.stage];
+    if(background && BndHasSerialRuns(runs)) return;
+    const CCTK_INT ierr = BndFinishStage(p.cctkGH,runs,p.st);
+    if(ierr < 0 && p.phase_retval == 0) p.phase_retval = ierr;
+    p.stage++;
+    BndNextStage(p);
+  }
+}
+
+/**
+ * Carry the pending BCs forward: once the driver is finished, apply
+ * the runs it left to this thread. Without block, start the driver
+ * again for the remaining stages and return whether all are done
+ * without waiting; with block, help with everything that is left and
+ * return true.
+ */
+static bool BndProgress(BndPending& p,bool block) {
+  /* done belongs to the driver while it runs */
+  while(p.running || !p.done) {
+    if(p.running) {
+      if(!block && !Boundary2::TestTasks()) return false;
+      {
+        Boundary2::BndTraceSpan wait(p.cctkGH,"wait for background BCs");
+        Boundary2::WaitTasks();
+      }
+      p.running = false;
+      if(p.done) break;
+      const CCTK_INT ierr = BndFinishStage(p.cctkGH,p.plans[p.phase].stages[p.stage],p.st);
+      if(ierr < 0 && p.phase_retval == 0) p.phase_retval = ierr;
+      p.stage++;
+      BndNextStage(p);
+      continue;
+    }
+    if(block) {
+      BndAdvance(p,false);
+    } else {
+      Boundary2::StartTasks(p.driver,1);
+      p.running = true;
+    }
+  }
+  return true;
+}
+
+/**
+ * Plan the BCs of the given phases (as for
+ * Boundary_ApplyPhysicalBCsToVars) and hand the driver to the pool.
+ */
+static void BndStartPending(const cGH *cctkGH,CCTK_INT num_vars,const CCTK_INT *var_indices,
+                            CCTK_INT before,CCTK_INT handle,const char *what) {
+  const std::vector<int> vars = BndVarList(num_vars,var_indices);
+  BndPending *p = new BndPending;
+  p->cctkGH = cctkGH;
+  p->handle = handle;
+  p->what = what;
+  for(int b=1;b>=0;b--) {
+    if(before >= 0 && (before != 0) != (b == 1)) continue;
+    p->phases.push_back(b);
+    p->vars.push_back(BndDirtyVars(cctkGH,b,vars));
+    p->plans.push_back(BndGetPlan(cctkGH,b,p->vars.back()));
+  }
+  p->phase = p->stage = p->wave = 0;
+  p->running = p->done = false;
+  p->phase_retval = p->retval = 0;
+  p->driver.resize(1);
+  p->driver[0].run = [p]() {
+    BndAdvance(*p,true);
+    return CCTK_INT(0);
+  };
+  p->driver[0].cost = 0;
+  p->driver[0].retval = 0;
+  bnd_pending = p;
+  {
+    Boundary2::BndTraceSpan span(cctkGH,handle ? "start asynchronous BCs" :
+                                 "start BCs before sync");
+    BndNextStage(*p);
+    BndProgress(*p,false);
+  }
+  p->started = Boundary2::BndTraceNow();
+}
+
+/**
+ * Complete the pending BCs and return their result.
+ */
+static CCTK_INT BndFinishPending() {
+  DECLARE_CCTK_PARAMETERS;
+  if(NULL==bnd_pending) return 0;
+  BndPending& p = *bnd_pending;
+  /* the time the caller had for other work while the BCs ran */
+  if(trace_timeline)
+    Boundary2::BndTraceEvent(p.handle ? "overlap with caller" : "overlap with exchange",
+                             "engine",p.started,NULL,0,0,p.cctkGH->cctk_levfac[0]);
+  {
+    Boundary2::BndTraceSpan span(p.cctkGH,p.handle ? "finish asynchronous BCs" :
+                                 "finish BCs before sync");
+    BndProgress(p,true);
+  }
+  for(size_t phase : p.applied) {
+    BndMarkApplied(p.cctkGH,p.phases[phase],p.vars[phase]);
+  }
+  const CCTK_INT retval = p.retval;
+  BndReportBatching(p.cctkGH,p.what);
+  delete bnd_pending;
+  bnd_pending = NULL;
+  return retval;
+}
+
+/**
+ * Whether handle names the pending asynchronous BCs; warns otherwise.
+ */
+static bool BndIsPendingHandle(CCTK_INT handle,const char *caller) {
+  if(handle > 0 && bnd_pending && bnd_pending->handle == handle) return true;
+  CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+             "%s called with handle %d, which names no pending boundary "
+             "conditions", caller, int(handle));
+  return false;
+}
+
+/**
+ * Apply the physical BCs selected for the given variables on the
+ * current component. A negative num_vars or a NULL var_indices means
+ * all selected variables. before selects the phase (1 for the BCs
+ * applied before the sync, 0 for those after it, negative for both).
+ * Returns 0, or the first negative error code of a BC.
+ */
+extern "C"
+CCTK_INT Bdry2_Boundary_ApplyPhysicalBCsToVars(
+    const cGH *cctkGH,
+    CCTK_INT num_vars,
+    const CCTK_INT *var_indices,
+    CCTK_INT before) {
+  if(bnd_pending && (bnd_pending->running || !bnd_pending->done)) {
+    CCTK_WARN(1, "Applying boundary conditions while others are still "
+                 "running in the background; finishing those first");
+    BndProgress(*bnd_pending,true);
+  }
+  const std::vector<int> vars = BndVarList(num_vars,var_indices);
+
+  CCTK_INT retval = 0;
+  for(int b=1;b>=0;b--) {
+    if(before >= 0 && (before != 0) != (b == 1)) continue;
+    Boundary2::BndTraceSpan span(cctkGH,b ? "BCs before sync" : "BCs after sync");
+    const std::vector<int> dirty = BndDirtyVars(cctkGH,b,vars);
+    BndPlan& plan = BndGetPlan(cctkGH,b,dirty);
+    CCTK_INT phase_retval = 0;
+    for(std::vector<BndRun>& runs : plan.stages) {
+      const CCTK_INT ierr = BndApplyStage(cctkGH,runs);
+      if(ierr < 0 && phase_retval == 0) phase_retval = ierr;
+    }
+    if(phase_retval == 0) BndMarkApplied(cctkGH,b,dirty);
+    else if(retval == 0) retval = phase_retval;
+  }
+  BndReportBatching(cctkGH,before < 0 ? "the BCs" :
+                    before ? "the BCs before sync" : "the BCs after sync");
+  return retval;
+}
+
+/**
+ * Start applying the physical BCs selected for the given variables on
+ * the current component (num_vars, var_indices and before as for
+ * Boundary_ApplyPhysicalBCsToVars) on the threads of the task pool,
+ * and return a handle for them without waiting, so that the caller
+ * can do other work meanwhile.
+ * Until Boundary_WaitPhysicalBCs returns for the handle, the caller
+ * must neither read nor write the boundary points of these variables,
+ * nor change selections. Only one application can be in flight at a
+ * time. Returns the handle (> 0), or -1 if BCs are still pending.
+ */
+extern "C"
+CCTK_INT Bdry2_Boundary_ApplyPhysicalBCsAsync(
+    const cGH *cctkGH,
+    CCTK_INT num_vars,
+    const CCTK_INT *var_indices,
+    CCTK_INT before) {
+  if(bnd_pending) {
+    CCTK_WARN(1, "Boundary_ApplyPhysicalBCsAsync called while other boundary "
+                 "conditions are pending; wait for those first");
+    return -1;
+  }
+  BndStartPending(cctkGH,num_vars,var_indices,before,++bnd_last_handle,
+                  "the asynchronous BCs");
+  return bnd_last_handle;
+}
+
+/**
+ * Check whether the BCs of handle are complete, without waiting for
+ * the background. If it is done up to runs which cannot be tasks,
+ * these are applied and the rest is started in the background again.
+ * Returns 1 if they are complete, so that Boundary_WaitPhysicalBCs
+ * returns at once, 0 if they are still running, or -1 for an unknown
+ * handle.
+ */
+extern "C"
+CCTK_INT Bdry2_Boundary_TestPhysicalBCs(
+    const cGH *cctkGH,
+    CCTK_INT handle) {
+  if(!BndIsPendingHandle(handle,"Boundary_TestPhysicalBCs")) return -1;
+  return BndProgress(*bnd_pending,false) ? 1 : 0;
+}
+
+/**
+ * Complete the BCs of handle, helping with those still to run. Returns
+ * 0, the first negative error code of a BC, or -1 for an unknown
+ * handle.
+ */
+extern "C"
+CCTK_INT Bdry2_Boundary_WaitPhysicalBCs(
+    const cGH *cctkGH,
+    CCTK_INT handle) {
+  if(!BndIsPendingHandle(handle,"Boundary_WaitPhysicalBCs")) return -1;
+  return BndFinishPending();
+}
+
+/**
+ * Start applying the before-sync physical BCs selected for the given
+ * variables on the current component, and return without waiting for
+ * them, so that the caller can exchange ghost zones meanwhile. The
+ * BCs only write the boundary points of the outer faces of the
+ * component. Until Boundary_FinishPhysicalBCsBeforeSync returns, the
+ * caller must neither read nor write those points, nor change
+ * selections. Returns 0, or a negative value if BCs are still pending.
+ */
+extern "C"
+CCTK_INT Bdry2_Boundary_StartPhysicalBCsBeforeSync(
+    const cGH *cctkGH,
+    CCTK_INT num_vars,
+    const CCTK_INT *var_indices) {
+  if(bnd_pending) {
+    CCTK_WARN(1, "Boundary_StartPhysicalBCsBeforeSync called while other "
+                 "boundary conditions are pending");
+    return -1;
+  }
+  BndStartPending(cctkGH,num_vars,var_indices,1,0,"the BCs before sync");
+  return 0;
+}
+
+/**
+ * Wait for the BCs started by Boundary_StartPhysicalBCsBeforeSync, and
+ * apply those which could not run in the background. Returns 0, or the
+ * first negative error code of a BC.
+ */
+extern "C"
+CCTK_INT Bdry2_Boundary_FinishPhysicalBCsBeforeSync(const cGH *cctkGH) {
+  if(bnd_pending && bnd_pending->handle != 0) {
+    CCTK_WARN(1, "Boundary_FinishPhysicalBCsBeforeSync called while "
+                 "asynchronous boundary conditions are pending");
+    return -1;
+  }
+  return BndFinishPending();
 }
 
 }
@@ -79,9 +79,9 @@
 
 static int ApplyBndRadiative(const cGH *GH, int stencil_dir,
                              const CCTK_INT *stencil_alldirs, int dir,
-                             CCTK_REAL var0, CCTK_REAL speed,
-                             CCTK_INT first_var_to, CCTK_INT first_var_from,
-                             int num_vars);
+                             CCTK_INT faces, const CCTK_REAL *var0s,
+                             const CCTK_REAL *speeds, CCTK_INT first_var_to,
+                             CCTK_INT first_var_from, int num_vars);
 
 /********************************************************************
  ********************    External Routines   ************************
@@ -128,6 +128,13 @@ static int ApplyBndRadiative(const cGH *GH, int stencil_dir,
    @vtype      CCTK_INT
    @vio        in
    @endvar
+   @history
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Read LIMIT and SPEED for every variable, so that variables
+               with their own tables but the same width are handled in
+               one call
+   @endhistory
    @returntype CCTK_INT
    @returndesc
                return code of @seeroutine ApplyBndRadiative
@@ -143,7 +150,7 @@ CCTK_INT Bndry_Radiative(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
   /* variables to pass to ApplyBndRadiative */
   CCTK_INT *width_alldirs; /* width of boundary in all directions */
   int dir;                 /* direction in which to apply bc */
-  CCTK_REAL limit, speed;
+  CCTK_REAL *limits, *speeds; /* LIMIT and SPEED of every variable */
   CCTK_INT
       prev_time_level; /* variable index which holds the previous time level */
 
@@ -163,57 +170,59 @@ CCTK_INT Bndry_Radiative(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
   retval = 0;
   width_alldirs = NULL;
   max_gdim = 0;
+  limits = (CCTK_REAL *)malloc(2 * num_vars * sizeof(CCTK_REAL));
+  speeds = limits + num_vars;
 
   /* loop through variables, j at a time */
   for (i = 0; i < num_vars; i += j) {
     /* find other adjacent vars which are selected for identical bcs */
     j = 1;
-    /* Since GFs are allowed to have different staggering, the best we
-       can do is find variables of the same group which are selected
-       for identical bcs.  If all GFs had the same staggering then we
-       could groups many GFs together. */
+    /* GFs are allowed to have different staggering, so only variables
+       of one group, or of groups with the same shape and staggering,
+       which are selected for identical bcs are handled together (see
+       BndCanBatchVars2).  Their tables may differ unless the boundary
+       width is taken from the table. */
     gi = CCTK_GroupIndexFromVarI(vars[i]);
 #ifdef DEBUG
     printf("starting increment computation with group %d:\n", gi);
     printf("this group had %d members\n", CCTK_NumVarsInGroupI(gi));
 #endif
     while (i + j < num_vars && vars[i + j] == vars[i] + j &&
-           CCTK_GroupIndexFromVarI(vars[i + j]) == gi &&
-           tables[i + j] == tables[i] && faces[i + j] == faces[i] &&
-           widths[i + j] == widths[i]) {
+           BndCanBatchVars2(GH, vars[i], vars[i + j]) &&
+           (tables[i + j] == tables[i] || widths[i] >= 0) &&
+           faces[i + j] == faces[i] && widths[i + j] == widths[i]) {
       ++j;
     }
 
-    /* Check to see if faces specification is valid */
-    if (faces[i] != CCTK_ALL_FACES) {
-      CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
-                 "Faces specification %d for Radiative boundary conditions on "
-                 "%s is not implemented yet.  "
-                 "Applying Radiative bcs to all (external) faces.",
-                 (int)faces[i], CCTK_VarName(vars[i]));
-    }
     dir = 0; /* apply bc to all faces */
 
     /* Set up default arguments for ApplyBndRadiative */
-    /* Defaults for remainder of arguments */
-    limit = 0.;
     prev_time_level = vars[i];
-    speed = 1.;
 
-    /* Look on table for possible non-default arguments
+    /* Look on the table of each variable for possible non-default
+     * arguments
      * (If any of these table look-ups fail, the value will be unchanged
      * from its default value)
      */
-    /* Asymptotic value of function at infinity */
-    err = Util_TableGetReal(tables[i], &limit, "LIMIT");
-    if (err == UTIL_ERROR_BAD_HANDLE) {
-      CCTK_VWarn(5, __LINE__, __FILE__, CCTK_THORNSTRING,
-                 "Invalid table handle passed for Radiative boundary "
-                 "conditions for %s.  Using all default values.",
-                 CCTK_VarName(vars[i]));
-    } else {
+    for (k = i; k < i + j; k++) {
+      /* Asymptotic value of function at infinity */
+      limits[k] = 0.;
       /* Wave speed */
-      Util_TableGetReal(tables[i], &speed, "SPEED");
+      speeds[k] = 1.;
+      if (k > i && tables[k] == tables[k - 1]) {
+        limits[k] = limits[k - 1];
+        speeds[k] = speeds[k - 1];
+        continue;
+      }
+      err = Util_TableGetReal(tables[k], &limits[k], "LIMIT");
+      if (err == UTIL_ERROR_BAD_HANDLE) {
+        CCTK_VWarn(5, __LINE__, __FILE__, CCTK_THORNSTRING,
+                   "Invalid table handle passed for Radiative boundary "
+                   "conditions for %s.  Using all default values.",
+                   CCTK_VarName(vars[k]));
+      } else {
+        Util_TableGetReal(tables[k], &speeds[k], "SPEED");
+      }
     }
 
     /* Determine boundary width on all faces */
@@ -234,12 +243,16 @@ CCTK_INT Bndry_Radiative(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
                    "Error %d when reading boundary width array from table "
                    "for %s",
                    err, CCTK_VarName(vars[i]));
+        free(width_alldirs);
+        free(limits);
         return -21;
       } else if (err != 2 * gdim) {
         CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
                    "Boundary width array for %s has %d elements, but %d "
                    "expected",
                    CCTK_VarName(vars[i]), err, 2 * gdim);
+        free(width_alldirs);
+        free(limits);
         return -22;
       }
     } else {
@@ -249,8 +262,9 @@ CCTK_INT Bndry_Radiative(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
     }
 
     /* Apply the boundary condition */
-    if ((retval = ApplyBndRadiative(GH, 0, width_alldirs, dir, limit, speed,
-                                    vars[i], prev_time_level, j)) < 0) {
+    if ((retval = ApplyBndRadiative(GH, 0, width_alldirs, dir, faces[i],
+                                    limits + i, speeds + i, vars[i],
+                                    prev_time_level, j)) < 0) {
       CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
                  "ApplyBndRadiative() returned %d", retval);
     }
@@ -259,6 +273,7 @@ CCTK_INT Bndry_Radiative(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
   printf("BndRadiative(): returning %d\n", retval);
 #endif
   free(width_alldirs);
+  free(limits);
 
   return retval;
 }
@@ -273,12 +288,96 @@ CCTK_INT Bndry_Radiative(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
 /* the maximum dimension we can deal with */
 #define MAXDIM 3
 
+/*@@
+   @routine    LOWER_RADIATIVE_ITEM
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Macro to apply radiative BC to the item _item of the
+               layer _layer of a lower bound, a row on z faces and a
+               plane on x and y faces.  LOWER_RADIATIVE_BOUNDARY_3D
+               loops over the items with or without threads.
+   @enddesc
+
+   @var        istart, jstart, kstart
+   @vdesc      start index for the x,y,z direction
+   @vtype      int
+   @vio        in
+   @endvar
+   @var        dim
+   @vdesc      dimension to apply BC
+   @vtype      int
+   @vio        in
+   @endvar
+   @var        cctk_type
+   @vdesc      CCTK datatypes of the source and target variable
+   @vtype      <cctk_type>
+   @vio        in
+   @endvar
+@@*/
+#define LOWER_RADIATIVE_ITEM(istart, jstart, kstart, dim, cctk_type)           \
+  {                                                                            \
+    int _i, _j, _k, _n;                                                        \
+    int _0 = 0 * offset[dim], _1 = 1 * offset[dim], _2 = 2 * offset[dim];      \
+                                                                               \
+    for (_n = _ninner - 1; _n >= 0; _n--) {                                    \
+      _j = (dim) == 2 ? _nouter - 1 - _item : _n;                              \
+      _k = (dim) == 2 ? _layer : _nouter - 1 - _item;                          \
+      int _idx = CCTK_GFINDEX3D(GH, istart - 1, _j, _k);                       \
+      const CCTK_REAL *_r = xyzr[MAXDIM] + _idx, *_xyz = xyzr[dim] + _idx;     \
+      cctk_type *_to = (cctk_type *)to_ptr + _idx;                             \
+      const cctk_type *_from = (const cctk_type *)from_ptr + _idx;             \
+                                                                               \
+      for (_i = istart - 1; _i >= 0; _i--) {                                   \
+        CCTK_REAL _r0_inv = 1 / _r[_0], _r1_inv = 1 / _r[_1];                  \
+        CCTK_REAL _dtvvar0H = dtvvar0;                                         \
+                                                                               \
+        if (radpower > 0) {                                                    \
+          CCTK_REAL H;                                                         \
+                                                                               \
+          H = 0.25 * radpower * dxyz[dim] *                                    \
+              (_xyz[_0] * SQR(_r0_inv) + _xyz[_1] * SQR(_r1_inv));             \
+          H = (1 + H) / (1 - H);                                               \
+          H *= dtv * (0.25 * (_to[_1] + _to[_2] + _from[_1] + _from[_2]) -     \
+                      var0) +                                                  \
+               0.5 * (_r[_1] * (_to[_1] - _from[_1]) +                         \
+                      _r[_2] * (_to[_2] - _from[_2])) +                        \
+               0.25 * (_to[_2] - _to[_1] + _from[_2] - _from[_1]) *            \
+                   rho[dim] *                                                  \
+                   (SQR(_r[_1]) / _xyz[_1] + SQR(_r[_2]) / _xyz[_2]);          \
+          _dtvvar0H = dtvvar0 + H;                                             \
+        }                                                                      \
+                                                                               \
+        _to[_0] = (cctk_type)(                                                 \
+            (_dtvvar0H *                                                       \
+                 (_xyz[_0] * SQR(_r0_inv) + _xyz[_1] * SQR(_r1_inv)) -         \
+             _to[_1] *                                                         \
+                 (rho[dim] + _xyz[_1] * _r1_inv * (1 + dtvh * _r1_inv)) +      \
+             _from[_0] *                                                       \
+                 (rho[dim] + _xyz[_0] * _r0_inv * (1 - dtvh * _r0_inv)) -      \
+             _from[_1] *                                                       \
+                 (rho[dim] - _xyz[_1] * _r1_inv * (1 - dtvh * _r1_inv))) /     \
+            (-rho[dim] + _xyz[_0] * _r0_inv * (1 + dtvh * _r0_inv)));          \
+        _r--;                                                                  \
+        _xyz--;                                                                \
+        _to--;                                                                 \
+        _from--;                                                               \
+      }                                                                        \
+    }                                                                          \
+  }
+
 /*@@
    @routine    LOWER_RADIATIVE_BOUNDARY_3D
    @date       Mon 9 Apr 2001
    @author     Thomas Radke
    @desc
                Macro to apply radiative BC to a lower bound of a 3D variable
+
+               Each point is computed from the points further inside
+               along the normal direction, so the loop along the normal
+               stays sequential and only the rows of a layer of a z face,
+               or the planes of an x or y face, are spread over OpenMP
+               threads.  A serial call does not enter a parallel region.
    @enddesc
 
    @var        istart, jstart, kstart
@@ -299,50 +398,111 @@ CCTK_INT Bndry_Radiative(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
 @@*/
 #define LOWER_RADIATIVE_BOUNDARY_3D(istart, jstart, kstart, dim, cctk_type)    \
   {                                                                            \
-    int _i, _j, _k;                                                            \
-    int _0 = 0 * offset[dim], _1 = 1 * offset[dim], _2 = 2 * offset[dim];      \
+    /* the layers of a z face go one after another from the inside out,        \
+       sharing out the rows of a layer; x and y faces share out planes */      \
+    const int _nlayers = (dim) == 2 ? (kstart) : 1;                            \
+    const int _nouter = (dim) == 2 ? (jstart) : (kstart);                      \
+    const int _ninner = (dim) == 2 ? 1 : (jstart);                             \
+    const CCTK_INT _npoints = (istart) * (jstart) * (kstart);                  \
+    int _layer, _item;                                                         \
                                                                                \
-    for (_k = kstart - 1; _k >= 0; _k--) {                                     \
-      for (_j = jstart - 1; _j >= 0; _j--) {                                   \
-        int _idx = CCTK_GFINDEX3D(GH, istart - 1, _j, _k);                     \
-        const CCTK_REAL *_r = xyzr[MAXDIM] + _idx, *_xyz = xyzr[dim] + _idx;   \
-        cctk_type *_to = (cctk_type *)to_ptr + _idx;                           \
-        const cctk_type *_from = (const cctk_type *)from_ptr + _idx;           \
+    /* each point reads from and the inner neighbour of to (a row or plane     \
+       away except on x faces), r and the normal coordinate, and writes to */  \
+    BndCountWork2(_npoints, 3 * sizeof(cctk_type) + 2 * sizeof(CCTK_REAL),     \
+                  radpower > 0 ? 70 : 35);                                     \
                                                                                \
-        for (_i = istart - 1; _i >= 0; _i--) {                                 \
-          CCTK_REAL _r0_inv = 1 / _r[_0], _r1_inv = 1 / _r[_1];                \
+    if (BndUseThreads2(_npoints)) {                                            \
+      _Pragma("omp parallel private(_layer)")                                  \
+      for (_layer = _nlayers - 1; _layer >= 0; _layer--) {                     \
+        _Pragma("omp for schedule(static)")                                    \
+        for (_item = 0; _item < _nouter; _item++) {                            \
+          LOWER_RADIATIVE_ITEM(istart, jstart, kstart, dim, cctk_type);        \
+        }                                                                      \
+      }                                                                        \
+    } else {                                                                   \
+      for (_layer = _nlayers - 1; _layer >= 0; _layer--) {                     \
+        for (_item = 0; _item < _nouter; _item++) {                            \
+          LOWER_RADIATIVE_ITEM(istart, jstart, kstart, dim, cctk_type);        \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+  }
+
+/*@@
+   @routine    UPPER_RADIATIVE_ITEM
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Macro to apply radiative BC to the item _item of the
+               layer _layer of a upper bound, a row on z faces and a
+               plane on x and y faces.  UPPER_RADIATIVE_BOUNDARY_3D
+               loops over the items with or without threads.
+   @enddesc
+
+   @var        istart, jstart, kstart
+   @vdesc      start index for the x,y,z direction
+   @vtype      int
+   @vio        in
+   @endvar
+   @var        dim
+   @vdesc      dimension to apply BC
+   @vtype      int
+   @vio        in
+   @endvar
+   @var        cctk_type
+   @vdesc      CCTK datatypes of the source and target variable
+   @vtype      <cctk_type>
+   @vio        in
+   @endvar
+@@*/
+#define UPPER_RADIATIVE_ITEM(istart, jstart, kstart, dim, cctk_type)           \
+  {                                                                            \
+    int _i, _j, _k, _n;                                                        \
+    int _0 = -0 * offset[dim], _1 = -1 * offset[dim];                          \
+    int _2 = -2 * offset[dim];                                                 \
                                                                                \
-          if (radpower > 0) {                                                  \
-            CCTK_REAL H;                                                       \
+    for (_n = 0; _n < _ninner; _n++) {                                         \
+      _j = (jstart) + ((dim) == 2 ? _item : _n);                               \
+      _k = (kstart) + ((dim) == 2 ? _layer : _item);                           \
+      int _idx = CCTK_GFINDEX3D(GH, istart, _j, _k);                           \
+      const CCTK_REAL *_r = xyzr[MAXDIM] + _idx, *_xyz = xyzr[dim] + _idx;     \
+      cctk_type *_to = (cctk_type *)to_ptr + _idx;                             \
+      const cctk_type *_from = (const cctk_type *)from_ptr + _idx;             \
                                                                                \
-            H = 0.25 * radpower * dxyz[dim] *                                  \
-                (_xyz[_0] * SQR(_r0_inv) + _xyz[_1] * SQR(_r1_inv));           \
-            H = (1 + H) / (1 - H);                                             \
-            H *= dtv * (0.25 * (_to[_1] + _to[_2] + _from[_1] + _from[_2]) -   \
-                        var0) +                                                \
-                 0.5 * (_r[_1] * (_to[_1] - _from[_1]) +                       \
-                        _r[_2] * (_to[_2] - _from[_2])) +                      \
-                 0.25 * (_to[_2] - _to[_1] + _from[_2] - _from[_1]) *          \
-                     rho[dim] *                                                \
-                     (SQR(_r[_1]) / _xyz[_1] + SQR(_r[_2]) / _xyz[_2]);        \
-            dtvvar0H = dtvvar0 + H;                                            \
-          }                                                                    \
+      for (_i = istart; _i < GH->cctk_lsh[0]; _i++) {                          \
+        CCTK_REAL _r0_inv = 1 / _r[_0], _r1_inv = 1 / _r[_1];                  \
+        CCTK_REAL _dtvvar0H = dtvvar0;                                         \
                                                                                \
-          _to[_0] = (cctk_type)(                                               \
-              (dtvvar0H *                                                      \
-                   (_xyz[_0] * SQR(_r0_inv) + _xyz[_1] * SQR(_r1_inv)) -       \
-               _to[_1] *                                                       \
-                   (rho[dim] + _xyz[_1] * _r1_inv * (1 + dtvh * _r1_inv)) +    \
-               _from[_0] *                                                     \
-                   (rho[dim] + _xyz[_0] * _r0_inv * (1 - dtvh * _r0_inv)) -    \
-               _from[_1] *                                                     \
-                   (rho[dim] - _xyz[_1] * _r1_inv * (1 - dtvh * _r1_inv))) /   \
-              (-rho[dim] + _xyz[_0] * _r0_inv * (1 + dtvh * _r0_inv)));        \
-          _r--;                                                                \
-          _xyz--;                                                              \
-          _to--;                                                               \
-          _from--;                                                             \
+        if (radpower > 0) {                                                    \
+          CCTK_REAL H;                                                         \
+                                                                               \
+          H = 0.25 * radpower * dxyz[dim] *                                    \
+              (_xyz[_0] * SQR(_r0_inv) + _xyz[_1] * SQR(_r1_inv));             \
+          H = (1 - H) / (1 + H);                                               \
+          H *= dtv * (0.25 * (_to[_1] + _to[_2] + _from[_1] + _from[_2]) -     \
+                      var0) +                                                  \
+               0.5 * (_r[_1] * (_to[_1] - _from[_1]) +                         \
+                      _r[_2] * (_to[_2] - _from[_2])) +                        \
+               0.25 * (_to[_1] - _to[_2] + _from[_1] - _from[_2]) *            \
+                   rho[dim] *                                                  \
+                   (SQR(_r[_1]) / _xyz[_1] + SQR(_r[_2]) / _xyz[_2]);          \
+          _dtvvar0H = dtvvar0 + H;                                             \
         }                                                                      \
+                                                                               \
+        _to[_0] = (cctk_type)(                                                 \
+            (_dtvvar0H *                                                       \
+                 (_xyz[_0] * (SQR(_r0_inv)) + _xyz[_1] * (SQR(_r1_inv))) +     \
+             _to[_1] *                                                         \
+                 (rho[dim] - _xyz[_1] * _r1_inv * (1 + dtvh * _r1_inv)) +      \
+             _from[_0] *                                                       \
+                 (-rho[dim] + _xyz[_0] * _r0_inv * (1 - dtvh * _r0_inv)) +     \
+             _from[_1] *                                                       \
+                 (rho[dim] + _xyz[_1] * _r1_inv * (1 - dtvh * _r1_inv))) /     \
+            (rho[dim] + _xyz[_0] * _r0_inv * (1 + dtvh * _r0_inv)));           \
+        _r++;                                                                  \
+        _xyz++;                                                                \
+        _to++;                                                                 \
+        _from++;                                                               \
       }                                                                        \
     }                                                                          \
   }
@@ -353,6 +513,8 @@ CCTK_INT Bndry_Radiative(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
    @author     Thomas Radke
    @desc
                Macro to apply radiative BC to an upper bound of a 3D variable
+
+               Threaded like LOWER_RADIATIVE_BOUNDARY_3D.
    @enddesc
 
    @var        istart, jstart, kstart
@@ -373,49 +535,29 @@ CCTK_INT Bndry_Radiative(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
 @@*/
 #define UPPER_RADIATIVE_BOUNDARY_3D(istart, jstart, kstart, dim, cctk_type)    \
   {                                                                            \
-    int _i, _j, _k;                                                            \
-    int _0 = -0 * offset[dim], _1 = -1 * offset[dim], _2 = -2 * offset[dim];   \
+    const int _nlayers = (dim) == 2 ? GH->cctk_lsh[2] - (kstart) : 1;          \
+    const int _nouter = (dim) == 2 ? GH->cctk_lsh[1] - (jstart)                \
+                                   : GH->cctk_lsh[2] - (kstart);               \
+    const int _ninner = (dim) == 2 ? 1 : GH->cctk_lsh[1] - (jstart);           \
+    const CCTK_INT _npoints =                                                  \
+        (GH->cctk_lsh[0] - (istart)) * _nlayers * _nouter * _ninner;           \
+    int _layer, _item;                                                         \
                                                                                \
-    for (_k = kstart; _k < GH->cctk_lsh[2]; _k++) {                            \
-      for (_j = jstart; _j < GH->cctk_lsh[1]; _j++) {                          \
-        int _idx = CCTK_GFINDEX3D(GH, istart, _j, _k);                         \
-        const CCTK_REAL *_r = xyzr[MAXDIM] + _idx, *_xyz = xyzr[dim] + _idx;   \
-        cctk_type *_to = (cctk_type *)to_ptr + _idx;                           \
-        const cctk_type *_from = (const cctk_type *)from_ptr + _idx;           \
+    BndCountWork2(_npoints, 3 * sizeof(cctk_type) + 2 * sizeof(CCTK_REAL),     \
+                  radpower > 0 ? 70 : 35);                                     \
                                                                                \
-        for (_i = istart; _i < GH->cctk_lsh[0]; _i++) {                        \
-          CCTK_REAL _r0_inv = 1 / _r[_0], _r1_inv = 1 / _r[_1];                \
-                                                                               \
-          if (radpower > 0) {                                                  \
-            CCTK_REAL H;                                                       \
-                                                                               \
-            H = 0.25 * radpower * dxyz[dim] *                                  \
-                (_xyz[_0] * SQR(_r0_inv) + _xyz[_1] * SQR(_r1_inv));           \
-            H = (1 - H) / (1 + H);                                             \
-            H *= dtv * (0.25 * (_to[_1] + _to[_2] + _from[_1] + _from[_2]) -   \
-                        var0) +                                                \
-                 0.5 * (_r[_1] * (_to[_1] - _from[_1]) +                       \
-                        _r[_2] * (_to[_2] - _from[_2])) +                      \
-                 0.25 * (_to[_1] - _to[_2] + _from[_1] - _from[_2]) *          \
-                     rho[dim] *                                                \
-                     (SQR(_r[_1]) / _xyz[_1] + SQR(_r[_2]) / _xyz[_2]);        \
-            dtvvar0H = dtvvar0 + H;                                            \
-          }                                                                    \
-                                                                               \
-          _to[_0] = (cctk_type)(                                               \
-              (dtvvar0H *                                                      \
-                   (_xyz[_0] * (SQR(_r0_inv)) + _xyz[_1] * (SQR(_r1_inv))) +   \
-               _to[_1] *                                                       \
-                   (rho[dim] - _xyz[_1] * _r1_inv * (1 + dtvh * _r1_inv)) +    \
-               _from[_0] *                                                     \
-                   (-rho[dim] + _xyz[_0] * _r0_inv * (1 - dtvh * _r0_inv)) +   \
-               _from[_1] *                                                     \
-                   (rho[dim] + _xyz[_1] * _r1_inv * (1 - dtvh * _r1_inv))) /   \
-              (rho[dim] + _xyz[_0] * _r0_inv * (1 + dtvh * _r0_inv)));         \
-          _r++;                                                                \
-          _xyz++;                                                              \
-          _to++;                                                               \
-          _from++;                                                             \
+    if (BndUseThreads2(_npoints)) {                                            \
+      _Pragma("omp parallel private(_layer)")                                  \
+      for (_layer = 0; _layer < _nlayers; _layer++) {                          \
+        _Pragma("omp for schedule(static)")                                    \
+        for (_item = 0; _item < _nouter; _item++) {                            \
+          UPPER_RADIATIVE_ITEM(istart, jstart, kstart, dim, cctk_type);        \
+        }                                                                      \
+      }                                                                        \
+    } else {                                                                   \
+      for (_layer = 0; _layer < _nlayers; _layer++) {                          \
+        for (_item = 0; _item < _nouter; _item++) {                            \
+          UPPER_RADIATIVE_ITEM(istart, jstart, kstart, dim, cctk_type);        \
         }                                                                      \
       }                                                                        \
     }                                                                          \
@@ -523,14 +665,19 @@ CCTK_INT Bndry_Radiative(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
    @vtype      int
    @vio        in
    @endvar
-   @var        var0
-   @vdesc      asymptotic value of function at infinity
-   @vtype      CCTK_REAL
+   @var        faces
+   @vdesc      set of faces to which to apply the bc
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @var        var0s
+   @vdesc      asymptotic value of function at infinity, for each variable
+   @vtype      const CCTK_REAL [ num_vars ]
    @vio        in
    @endvar
-   @var        speed
-   @vdesc      wave speed
-   @vtype      CCTK_REAL
+   @var        speeds
+   @vdesc      wave speed, for each variable
+   @vtype      const CCTK_REAL [ num_vars ]
    @vio        in
    @endvar
    @var        first_var_to
@@ -551,11 +698,30 @@ CCTK_INT Bndry_Radiative(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
    @calls      CCTK_VarTypeI
                CCTK_GroupDimFromVarI
                RADIATIVE_BOUNDARY
+               BndCountWork2
    @history
    @hdate      Mon 9 Apr 2001
    @hauthor    Thomas Radke
    @hdesc      Merged separate routines for 1D, 2D, and 3D
                into a single generic routine
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Apply each face to all variables at once, spreading the
+               rows over OpenMP threads; stencil offsets use cctk_ash
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Honor the faces specification
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Record the modelled memory traffic and flops of each loop
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Take the asymptotic value and the wave speed per variable
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Go through the variables one after another again, which
+               keeps the data of a variable in cache across its faces,
+               and enter a parallel region only when a face is threaded
    @endhistory
 
    @returntype int
@@ -570,11 +736,11 @@ CCTK_INT Bndry_Radiative(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
    @endreturndesc
 @@*/
 static int ApplyBndRadiative(const cGH *GH, int width_dir,
-                             const CCTK_INT *in_widths, int dir, CCTK_REAL var0,
-                             CCTK_REAL speed, CCTK_INT first_var_to,
-                             CCTK_INT first_var_from, int num_vars) {
-  int i, gdim, indx;
-  int var_to, var_from;
+                             const CCTK_INT *in_widths, int dir, CCTK_INT faces,
+                             const CCTK_REAL *var0s, const CCTK_REAL *speeds,
+                             CCTK_INT first_var_to, CCTK_INT first_var_from,
+                             int num_vars) {
+  int i, v, gdim, indx;
   int timelvl_from;
   char coord_system_name[10];
   int written;
@@ -585,7 +751,7 @@ static int ApplyBndRadiative(const cGH *GH, int width_dir,
   CCTK_INT symbnd[2 * MAXDIM];
   CCTK_INT is_physical[2 * MAXDIM];
   CCTK_INT ierr;
-  CCTK_REAL dtv, dtvh, dtvvar0, dtvvar0H;
+  CCTK_REAL var0, dtv, dtvh, dtvvar0;
   void *to_ptr;
   const void *from_ptr;
   DECLARE_CCTK_PARAMETERS
@@ -631,12 +797,6 @@ static int ApplyBndRadiative(const cGH *GH, int width_dir,
     timelvl_from = 1;
   }
 
-  /* Find Courant parameters. */
-  dtv = speed * GH->cctk_delta_time;
-  dtvh = 0.5 * dtv;
-  dtvvar0 = dtv * var0;
-  dtvvar0H = dtvvar0;
-
   written = snprintf(coord_system_name, sizeof(coord_system_name), "cart%dd",
                      gdim);
   if (written >= sizeof(coord_system_name)) {
@@ -657,9 +817,7 @@ static int ApplyBndRadiative(const cGH *GH, int width_dir,
        grid are calculated as follows: */
     dxyz[i] = GH->cctk_delta_space[i] / GH->cctk_levfac[i];
 
-    rho[i] = dtv / dxyz[i];
-
-    offset[i] = i == 0 ? 1 : offset[i - 1] * GH->cctk_lsh[i - 1];
+    offset[i] = i == 0 ? 1 : offset[i - 1] * GH->cctk_ash[i - 1];
   }
 
   /* Append r grid variable to end of xyzr[] array */
@@ -688,31 +846,40 @@ static int ApplyBndRadiative(const cGH *GH, int width_dir,
     is_physical[i] = symbnd[i] < 0;
   }
 
-  /* now loop over all variables */
-  for (var_to = first_var_to, var_from = first_var_from;
-       var_to < first_var_to + num_vars; var_to++, var_from++) {
-    to_ptr = GH->data[var_to][0];
-    from_ptr = GH->data[var_from][timelvl_from];
-
-    /* Apply condition if:
-       + boundary is a physical boundary
-       + boundary is an outer boundary
-       + have enough grid points
-    */
-    for (i = 0; i < 2 * MAXDIM; i++) {
-      doBC[i] = is_physical[i];
+  /* Apply condition if:
+     + boundary is a physical boundary
+     + boundary is an outer boundary
+     + have enough grid points
+  */
+  for (i = 0; i < 2 * MAXDIM; i++) {
+    doBC[i] = is_physical[i] && (faces == CCTK_ALL_FACES || (faces & (1<<i)));
+  }
+  for (i = 0; i < MAXDIM; i++) {
+    doBC[i * 2] &= GH->cctk_lsh[i] > widths[i * 2] && GH->cctk_bbox[i * 2];
+    doBC[i * 2 + 1] &=
+        GH->cctk_lsh[i] > widths[i * 2 + 1] && GH->cctk_bbox[i * 2 + 1];
+    if (dir != 0) {
+      doBC[i * 2] &= (dir < 0 && (i + 1 == abs(dir)));
+      doBC[i * 2 + 1] &= (dir > 0 && (i + 1 == abs(dir)));
     }
-    for (i = 0; i < MAXDIM; i++) {
-      doBC[i * 2] &= GH->cctk_lsh[i] > widths[i * 2] && GH->cctk_bbox[i * 2];
-      doBC[i * 2 + 1] &=
-          GH->cctk_lsh[i] > widths[i * 2 + 1] && GH->cctk_bbox[i * 2 + 1];
-      if (dir != 0) {
-        doBC[i * 2] &= (dir < 0 && (i + 1 == abs(dir)));
-        doBC[i * 2 + 1] &= (dir > 0 && (i + 1 == abs(dir)));
-      }
+  }
+
+  /* now loop over all variables, applying all faces of one variable
+     before the next so that its data stays in cache */
+  for (v = 0; v < num_vars; v++) {
+    to_ptr = GH->data[first_var_to + v][0];
+    from_ptr = GH->data[first_var_from + v][timelvl_from];
+
+    /* Find Courant parameters. */
+    var0 = var0s[v];
+    dtv = speeds[v] * GH->cctk_delta_time;
+    dtvh = 0.5 * dtv;
+    dtvvar0 = dtv * var0;
+    for (i = 0; i < gdim; i++) {
+      rho[i] = dtv / dxyz[i];
     }
 
-    switch (CCTK_VarTypeI(var_to)) {
+    switch (CCTK_VarTypeI(first_var_to)) {
     case CCTK_VARIABLE_REAL:
       RADIATIVE_BOUNDARY(GH->cctk_lsh, widths, CCTK_REAL);
       break;
@@ -738,7 +905,7 @@ static int ApplyBndRadiative(const cGH *GH, int width_dir,
     default:
       CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
                  "Unsupported variable type %d for variable '%s'",
-                 CCTK_VarTypeI(var_to), CCTK_VarName(var_to));
+                 CCTK_VarTypeI(first_var_to), CCTK_VarName(first_var_to));
       return (-4);
     }
   }
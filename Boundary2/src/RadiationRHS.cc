@@ -0,0 +1,373 @@
+/*@@
+  @file      RadiationRHS.cc
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Radiation (Sommerfeld) boundary condition applied to the
+             right hand side of an evolution system instead of the state.
+
+             Bndry_Radiative updates the state after every substep from
+             the previous time level.  Boundary_ApplyRadiationRHS is
+             called instead from the routine which computes the right
+             hand sides, as with thorn NewRad: at every boundary point it
+             sets the right hand side to
+
+               dt u = - v0 (x^i/r d_i u + (u - u0) / r)
+
+             with second order derivatives, centred where possible and
+             one-sided towards the interior in the boundary zones.  With
+             radpower >= 0 the difference between the right hand side
+             and this expression at the nearest interior point along the
+             normal is added, decaying as (r_interior / r)^radpower.
+             Only interior points are read, so all boundary points are
+             independent; the boundary is walked once for all variables
+             of a call, row by row.
+  @enddesc
+  @version   $Header$
+@@*/
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "cctk.h"
+
+#include "Boundary2.h"
+#include "Timers.h"
+
+namespace Boundary2 {
+
+namespace {
+
+/* the stencil of the derivative along one direction, as offsets and
+   weights of the points, to be divided by twice the spacing */
+struct RHSStencil {
+  std::ptrdiff_t off1, off2;
+  CCTK_REAL w0, w1, w2;
+
+  /* s is 0 for a centred derivative, and +1 or -1 for one which is
+     one-sided towards larger or smaller indices */
+  RHSStencil(int s, std::ptrdiff_t stride) {
+    if (s == 0) {
+      off1 = stride;
+      off2 = -stride;
+      w0 = 0;
+      w1 = 1;
+      w2 = -1;
+    } else {
+      off1 = s * stride;
+      off2 = 2 * s * stride;
+      w0 = -3 * s;
+      w1 = 4 * s;
+      w2 = -s;
+    }
+  }
+};
+
+/* the variables of a call and their parameters */
+struct RHSVar {
+  const CCTK_REAL *u;
+  CCTK_REAL *rhs;
+  CCTK_REAL u0, v0;
+};
+
+/* direction of the one-sided derivative at index i of a direction with
+   n points and boundary zones of width wl and wu; the outermost point
+   of a face which is not an outer boundary has no neighbour there
+   either */
+inline int RHSSide(int i, int n, int wl, int wu) {
+  return i < wl || i == 0 ? 1 : i >= n - wu || i == n - 1 ? -1 : 0;
+}
+
+/* the Sommerfeld right hand side at index p */
+inline CCTK_REAL RHSSommerfeld(const RHSVar &v, const CCTK_REAL *const xyzr[4],
+                               const RHSStencil st[3],
+                               const CCTK_REAL idx2[3], std::ptrdiff_t p) {
+  const CCTK_REAL u = v.u[p];
+  const CCTK_REAL rinv = 1 / xyzr[3][p];
+  CCTK_REAL adv = 0;
+  for (int d = 0; d < 3; d++) {
+    const CCTK_REAL du = (st[d].w0 * u + st[d].w1 * v.u[p + st[d].off1] +
+                          st[d].w2 * v.u[p + st[d].off2]) *
+                         idx2[d];
+    adv += xyzr[d][p] * du;
+  }
+  return -v.v0 * (adv + (u - v.u0)) * rinv;
+}
+
+/* x^n for n >= 0 by repeated squaring, which unlike std::pow can be
+   vectorized */
+inline CCTK_REAL RHSPow(CCTK_REAL x, int n) {
+  CCTK_REAL result = 1;
+  for (; n > 0; n >>= 1) {
+    if (n & 1) {
+      result *= x;
+    }
+    x *= x;
+  }
+  return result;
+}
+
+} // namespace
+
+} // namespace Boundary2
+
+using namespace Boundary2;
+
+/*@@
+   @routine    Bdry2_Boundary_ApplyRadiationRHS
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Set the right hand sides rhs_indices[v] at the outer
+               boundary points of the variables var_indices[v] to the
+               radiation condition with asymptotic value var0s[v] and
+               speed speeds[v].  The boundary is width points wide on
+               every outer face without a symmetry.  All variables must
+               be 3D real grid functions of one shape.
+   @enddesc
+   @calls      BndPointwiseGrid2
+               BndUseThreads2
+               BndCountWork2
+
+   @var        cctkGH
+   @vdesc      Pointer to CCTK grid hierarchy
+   @vtype      const cGH *
+   @vio        in
+   @endvar
+   @var        num_vars
+   @vdesc      number of variables
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @var        var_indices
+   @vdesc      indices of the evolved variables
+   @vtype      const CCTK_INT *
+   @vio        in
+   @endvar
+   @var        rhs_indices
+   @vdesc      indices of their right hand sides
+   @vtype      const CCTK_INT *
+   @vio        in
+   @endvar
+   @var        var0s
+   @vdesc      asymptotic values of the variables
+   @vtype      const CCTK_REAL *
+   @vio        in
+   @endvar
+   @var        speeds
+   @vdesc      propagation speeds of the variables
+   @vtype      const CCTK_REAL *
+   @vio        in
+   @endvar
+   @var        width
+   @vdesc      width of the boundary zones
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+   @var        radpower
+   @vdesc      decay power of the interior correction, or negative to
+               switch it off
+   @vtype      CCTK_INT
+   @vio        in
+   @endvar
+
+   @returntype CCTK_INT
+   @returndesc
+                0 for success
+               -1 if width is negative or a variable index is invalid
+               -2 if a variable is not a 3D grid function
+               -4 if a variable is not of type CCTK_REAL or the
+                  variables do not have one shape
+               -6 if a coordinate is not found
+   @endreturndesc
+@@*/
+extern "C" CCTK_INT Bdry2_Boundary_ApplyRadiationRHS(
+    const cGH *cctkGH, CCTK_INT num_vars, const CCTK_INT *var_indices,
+    const CCTK_INT *rhs_indices, const CCTK_REAL *var0s,
+    const CCTK_REAL *speeds, CCTK_INT width, CCTK_INT radpower) {
+  static const std::string bc_name("radiation_rhs");
+
+  if (num_vars <= 0) {
+    return 0;
+  }
+  if (width < 0) {
+    CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+               "Invalid boundary width %d for the radiation condition on "
+               "the right hand side",
+               int(width));
+    return -1;
+  }
+  for (int v = 0; v < num_vars; v++) {
+    const CCTK_INT vars[2] = {var_indices[v], rhs_indices[v]};
+    for (CCTK_INT var : vars) {
+      if (var < 0 || var >= CCTK_NumVars()) {
+        CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                   "Invalid variable index %d for the radiation condition "
+                   "on the right hand side",
+                   int(var));
+        return -1;
+      }
+      if (CCTK_GroupTypeI(CCTK_GroupIndexFromVarI(var)) != CCTK_GF ||
+          CCTK_GroupDimFromVarI(var) != 3) {
+        CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                   "The radiation condition on the right hand side needs "
+                   "3D grid functions, but %s is not one",
+                   CCTK_VarName(var));
+        return -2;
+      }
+      if (CCTK_VarTypeI(var) != CCTK_VARIABLE_REAL ||
+          !BndCanBatchVars2(cctkGH, var_indices[0], var)) {
+        CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                   "The radiation condition on the right hand side needs "
+                   "CCTK_REAL variables of one shape, but %s is not",
+                   CCTK_VarName(var));
+        return -4;
+      }
+    }
+  }
+
+  /* the one-sided derivatives read two more points inside */
+  BndPointwiseGrid g;
+  const int err = BndPointwiseGrid2(cctkGH, var_indices[0], CCTK_ALL_FACES,
+                                    width, -1, 2, 0, 1, &g);
+  if (err < 0) {
+    return err;
+  }
+
+  BndTimer timer(cctkGH, bc_name, var_indices, num_vars, CCTK_ALL_FACES);
+
+  std::vector<RHSVar> rvs(num_vars);
+  for (int v = 0; v < num_vars; v++) {
+    rvs[v].u = (const CCTK_REAL *)cctkGH->data[var_indices[v]][0];
+    rvs[v].rhs = (CCTK_REAL *)cctkGH->data[rhs_indices[v]][0];
+    rvs[v].u0 = var0s[v];
+    rvs[v].v0 = speeds[v];
+  }
+
+  /* the boundary zones; faces without the condition have none */
+  int wl[3], wu[3];
+  CCTK_REAL idx2[3];
+  for (int d = 0; d < 3; d++) {
+    wl[d] = g.doBC[2 * d] ? g.width[2 * d] : 0;
+    wu[d] = g.doBC[2 * d + 1] ? g.width[2 * d + 1] : 0;
+    idx2[d] = 1 / (2 * g.delta[d]);
+  }
+  const int nx = g.lsh[0];
+  const int nrows = g.lsh[1] * g.lsh[2];
+  const CCTK_INT npoints =
+      CCTK_INT(g.lsh[0]) * g.lsh[1] * g.lsh[2] -
+      CCTK_INT(g.lsh[0] - wl[0] - wu[0]) * (g.lsh[1] - wl[1] - wu[1]) *
+          (g.lsh[2] - wl[2] - wu[2]);
+
+  /* u, its stencil and the rhs, the coordinates, and the interior
+     point for the correction */
+  BndCountWork2(npoints * num_vars,
+                (8 + (radpower >= 0 ? 8 : 0)) * sizeof(CCTK_REAL),
+                radpower >= 0 ? 60 : 25);
+
+  const auto apply_row = [&](int row) {
+    const int j = row % g.lsh[1], k = row / g.lsh[1];
+    const int sj = RHSSide(j, g.lsh[1], wl[1], wu[1]);
+    const int sk = RHSSide(k, g.lsh[2], wl[2], wu[2]);
+    const bool bj = j < wl[1] || j >= g.lsh[1] - wu[1];
+    const bool bk = k < wl[2] || k >= g.lsh[2] - wu[2];
+    /* distance of the row from the interior along y and z */
+    const int nj = j < wl[1] ? wl[1] - j : bj ? j - (g.lsh[1] - wu[1] - 1) : 0;
+    const int nk = k < wl[2] ? wl[2] - k : bk ? k - (g.lsh[2] - wu[2] - 1) : 0;
+
+    /* the row splits into segments with one x stencil: the lower x
+       zone, the middle, and the upper x zone; the middle is a boundary
+       segment only if the row lies in a y or z zone */
+    const int seg[4] = {0, wl[0], nx - wu[0], nx};
+    for (int s = 0; s < 3; s++) {
+      if ((s == 1 && !bj && !bk) || seg[s] >= seg[s + 1]) {
+        continue;
+      }
+      for (int i0 = seg[s]; i0 < seg[s + 1];) {
+        /* points of constant stencil; the outermost points of faces
+           without the condition have their own */
+        const int si = RHSSide(i0, nx, wl[0], wu[0]);
+        int i1 = i0 + 1;
+        while (i1 < seg[s + 1] && RHSSide(i1, nx, wl[0], wu[0]) == si) {
+          i1++;
+        }
+        const RHSStencil st[3] = {RHSStencil(si, g.stride[0]),
+                                  RHSStencil(sj, g.stride[1]),
+                                  RHSStencil(sk, g.stride[2])};
+        const std::ptrdiff_t start = j * g.stride[1] + k * g.stride[2];
+
+        for (const RHSVar &rv : rvs) {
+          if (radpower < 0) {
+#pragma omp simd
+            for (int i = i0; i < i1; i++) {
+              rv.rhs[start + i] = RHSSommerfeld(rv, g.xyzr, st, idx2, start + i);
+            }
+          } else if (s == 1) {
+            /* in the middle of the row the nearest interior point along
+               the inward diagonal is the same distance away from every
+               point, and has the same stencil */
+            const int n = std::max(nj, nk);
+            const std::ptrdiff_t dq = n * ((nj ? sj : 0) * g.stride[1] +
+                                           (nk ? sk : 0) * g.stride[2]);
+            const RHSStencil sq[3] = {
+                st[0],
+                RHSStencil(RHSSide(j + n * (nj ? sj : 0), g.lsh[1], wl[1],
+                                   wu[1]),
+                           g.stride[1]),
+                RHSStencil(RHSSide(k + n * (nk ? sk : 0), g.lsh[2], wl[2],
+                                   wu[2]),
+                           g.stride[2])};
+#pragma omp simd
+            for (int i = i0; i < i1; i++) {
+              const std::ptrdiff_t p = start + i;
+              const CCTK_REAL aux =
+                  rv.rhs[p + dq] - RHSSommerfeld(rv, g.xyzr, sq, idx2, p + dq);
+              rv.rhs[p] = RHSSommerfeld(rv, g.xyzr, st, idx2, p) +
+                          aux * RHSPow(g.xyzr[3][p + dq] / g.xyzr[3][p],
+                                       radpower);
+            }
+          } else {
+            /* in the x zones the interior point moves with the point */
+            for (int i = i0; i < i1; i++) {
+              const std::ptrdiff_t p = start + i;
+              const int ni = i < wl[0] ? wl[0] - i : i - (nx - wu[0] - 1);
+              const int n = std::max(ni, std::max(nj, nk));
+              const std::ptrdiff_t q =
+                  p + n * (si * g.stride[0] + (nj ? sj : 0) * g.stride[1] +
+                           (nk ? sk : 0) * g.stride[2]);
+              const RHSStencil sq[3] = {
+                  RHSStencil(RHSSide(i + n * si, nx, wl[0], wu[0]),
+                             g.stride[0]),
+                  RHSStencil(RHSSide(j + n * (nj ? sj : 0), g.lsh[1], wl[1],
+                                     wu[1]),
+                             g.stride[1]),
+                  RHSStencil(RHSSide(k + n * (nk ? sk : 0), g.lsh[2], wl[2],
+                                     wu[2]),
+                             g.stride[2])};
+              const CCTK_REAL aux =
+                  rv.rhs[q] - RHSSommerfeld(rv, g.xyzr, sq, idx2, q);
+              rv.rhs[p] = RHSSommerfeld(rv, g.xyzr, st, idx2, p) +
+                          aux * RHSPow(g.xyzr[3][q] / g.xyzr[3][p], radpower);
+            }
+          }
+        }
+        i0 = i1;
+      }
+    }
+  };
+
+  if (BndUseThreads2(npoints * num_vars)) {
+#pragma omp parallel for schedule(static)
+    for (int row = 0; row < nrows; row++) {
+      apply_row(row);
+    }
+  } else {
+    for (int row = 0; row < nrows; row++) {
+      apply_row(row);
+    }
+  }
+
+  return 0;
+}
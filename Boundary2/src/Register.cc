@@ -1,6 +1,7 @@
 #include "cctk.h"
 #include "cctk_Arguments.h"
 #include "cctk_Parameters.h"
+#include "cctk_Functions.h"
 #include <algorithm>
 #include "Boundary2.h"
 
@@ -10,9 +11,15 @@ void Boundary2_RegisterBCs(CCTK_ARGUMENTS)
 
   CCTK_INFO("Registering Boundary Conditions");
 
+  /* Boundary points owned by a component only depend on points further
+     inside it, so the BCs can be applied before (and overlap with) the
+     ghost zone exchange, which later overwrites the boundary points in
+     the ghost zones.  Copy reads the boundary of another variable and
+     therefore waits until all other BCs are done. */
+
   if (register_scalar) {
     int err = 0;
-    err = Boundary_RegisterPhysicalBC(cctkGH, (boundary_function)Bndry_Scalar, "scalar");
+    err = Boundary_RegisterPhysicalBCPhase(cctkGH, (boundary_function)Bndry_Scalar, "scalar", local_bcs_before_sync);
     if (err) {
       CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
                  "Error %d when registering routine to handle \"Scalar\" "
@@ -23,7 +30,7 @@ void Boundary2_RegisterBCs(CCTK_ARGUMENTS)
 
   if (register_flat) {
     int err = 0;
-    err = Boundary_RegisterPhysicalBC(cctkGH, (boundary_function)Bndry_Flat, "flat");
+    err = Boundary_RegisterPhysicalBCPhase(cctkGH, (boundary_function)Bndry_Flat, "flat", local_bcs_before_sync);
     if (err) {
       CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
                  "Error %d when registering routine to handle \"Flat\" "
@@ -34,7 +41,7 @@ void Boundary2_RegisterBCs(CCTK_ARGUMENTS)
 
   if (register_radiation) {
     int err = 0;
-    err = Boundary_RegisterPhysicalBC(cctkGH, (boundary_function)Bndry_Radiative, "radiation");
+    err = Boundary_RegisterPhysicalBCPhase(cctkGH, (boundary_function)Bndry_Radiative, "radiation", local_bcs_before_sync);
     if (err) {
       CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
                  "Error %d when registering routine to handle \"Radiation\" "
@@ -45,7 +52,7 @@ void Boundary2_RegisterBCs(CCTK_ARGUMENTS)
 
   if (register_copy) {
     int err = 0;
-    err = Boundary_RegisterPhysicalBC(cctkGH, (boundary_function)Bndry_Copy, "copy");
+    err = Boundary_RegisterPhysicalBCPhase(cctkGH, (boundary_function)Bndry_Copy, "copy", 0);
     if (err) {
       CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
                  "Error %d when registering routine to handle \"Copy\" "
@@ -56,7 +63,7 @@ void Boundary2_RegisterBCs(CCTK_ARGUMENTS)
 
   if (register_robin) {
     int err = 0;
-    err = Boundary_RegisterPhysicalBC(cctkGH, (boundary_function)Bndry_Robin, "robin");
+    err = Boundary_RegisterPhysicalBCPhase(cctkGH, (boundary_function)Bndry_Robin, "robin", local_bcs_before_sync);
     if (err) {
       CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
                  "Error %d when registering routine to handle \"Robin\" "
@@ -67,7 +74,7 @@ void Boundary2_RegisterBCs(CCTK_ARGUMENTS)
 
   if (register_static) {
     int err = 0;
-    err = Boundary_RegisterPhysicalBC(cctkGH, (boundary_function)Bndry_Static, "static");
+    err = Boundary_RegisterPhysicalBCPhase(cctkGH, (boundary_function)Bndry_Static, "static", local_bcs_before_sync);
     if (err) {
       CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
                  "Error %d when registering routine to handle \"Static\" "
@@ -76,9 +83,31 @@ void Boundary2_RegisterBCs(CCTK_ARGUMENTS)
     }
   }
 
+  if (register_extrapolate) {
+    int err = 0;
+    err = Boundary_RegisterPhysicalBCPhase(cctkGH, (boundary_function)Bndry_Extrapolate, "extrapolate", local_bcs_before_sync);
+    if (err) {
+      CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                 "Error %d when registering routine to handle \"Extrapolate\" "
+                 "boundary condition",
+                 err);
+    }
+  }
+
+  if (register_outflow) {
+    int err = 0;
+    err = Boundary_RegisterPhysicalBCPhase(cctkGH, (boundary_function)Bndry_Outflow, "outflow", local_bcs_before_sync);
+    if (err) {
+      CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+                 "Error %d when registering routine to handle \"Outflow\" "
+                 "boundary condition",
+                 err);
+    }
+  }
+
   if (register_none) {
     int err = 0;
-    err = Boundary_RegisterPhysicalBC(cctkGH, (boundary_function)Bndry_None, "none");
+    err = Boundary_RegisterPhysicalBCPhase(cctkGH, (boundary_function)Bndry_None, "none", local_bcs_before_sync);
     if (err) {
       CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
                  "Error %d when registering routine to handle \"None\" "
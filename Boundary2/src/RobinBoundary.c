@@ -26,8 +26,9 @@
 
 #include "Boundary2.h"
 
-static int ApplyBndRobin(const cGH *GH, const CCTK_INT *stencil, CCTK_REAL finf,
-                         int npow, int first_var, int num_vars);
+static int ApplyBndRobin(const cGH *GH, const CCTK_INT *stencil,
+                         CCTK_INT faces, const CCTK_REAL *finf,
+                         const CCTK_INT *npow, int first_var, int num_vars);
 
 /********************************************************************
  ********************    External Routines   ************************
@@ -72,6 +73,13 @@ static int ApplyBndRobin(const cGH *GH, const CCTK_INT *stencil, CCTK_REAL finf,
    @vtype      CCTK_INT
    @vio        in
    @endvar
+   @history
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Read FINF and DECAY_POWER for every variable, so that
+               variables with their own tables but the same width are
+               handled in one call
+   @endhistory
    @returntype CCTK_INT
    @returndesc
                return code of @seeroutine ApplyBndRobin
@@ -86,8 +94,8 @@ CCTK_INT Bndry_Robin(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
 
   /* variables to pass to ApplyBndRobin */
   CCTK_INT *width_alldirs; /* width of boundary in all directions */
-  CCTK_REAL finf;          /* value of function at infinity */
-  CCTK_INT npow;           /* decay rate */
+  CCTK_REAL *finfs;        /* value of function at infinity */
+  CCTK_INT *npows;         /* decay rate */
 
 #ifdef DEBUG
   printf(
@@ -98,50 +106,50 @@ CCTK_INT Bndry_Robin(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
   retval = 0;
   width_alldirs = NULL;
   max_gdim = 0;
+  finfs = (CCTK_REAL *)malloc(num_vars * sizeof(CCTK_REAL));
+  npows = (CCTK_INT *)malloc(num_vars * sizeof(CCTK_INT));
 
   /* loop through variables, j at a time */
   for (i = 0; i < num_vars; i += j) {
     /* find other adjacent vars which are selected for identical bcs */
     j = 1;
-    /* Since GFs are allowed to have different staggering, the best we
-       can do is find variables of the same group which are selected
-       for identical bcs.  If all GFs had the same staggering then we
-       could groups many GFs together. */
+    /* GFs are allowed to have different staggering, so only variables
+       of one group, or of groups with the same shape and staggering,
+       which are selected for identical bcs are handled together (see
+       BndCanBatchVars2).  Their tables may differ unless the boundary
+       width is taken from the table. */
     gi = CCTK_GroupIndexFromVarI(vars[i]);
     while (i + j < num_vars && vars[i + j] == vars[i] + j &&
-           CCTK_GroupIndexFromVarI(vars[i + j]) == gi &&
-           tables[i + j] == tables[i] && faces[i + j] == faces[i] &&
-           widths[i + j] == widths[i]) {
+           BndCanBatchVars2(GH, vars[i], vars[i + j]) &&
+           (tables[i + j] == tables[i] || widths[i] >= 0) &&
+           faces[i + j] == faces[i] && widths[i + j] == widths[i]) {
       ++j;
     }
 
-    /* Check to see if faces specification is valid */
-    if (faces[i] != CCTK_ALL_FACES) {
-      CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
-                 "Faces specification %d for Robin boundary conditions on "
-                 "%s is not implemented yet.  "
-                 "Applying Robin bcs to all (external) faces.",
-                 (int)faces[i], CCTK_VarName(vars[i]));
-    }
-
-    /* Set up default arguments for ApplyBndRobin */
-    finf = 0;
-    npow = 1;
-
-    /* Look on table for possible non-default arguments
+    /* Look on the table of each variable for possible non-default
+     * arguments
      * (If any of these table look-ups fail, the value will be unchanged
      * from its default value)
      */
-    /* Asymptotic value of function at infinity */
-    err = Util_TableGetReal(tables[i], &finf, "FINF");
-    if (err == UTIL_ERROR_BAD_HANDLE) {
-      CCTK_VWarn(5, __LINE__, __FILE__, CCTK_THORNSTRING,
-                 "Invalid table handle passed for Robin boundary "
-                 "conditions for %s.  Using all default values.",
-                 CCTK_VarName(vars[i]));
-    } else {
+    for (k = i; k < i + j; k++) {
+      /* Asymptotic value of function at infinity */
+      finfs[k] = 0;
       /* Decay power */
-      Util_TableGetInt(tables[i], &npow, "DECAY_POWER");
+      npows[k] = 1;
+      if (k > i && tables[k] == tables[k - 1]) {
+        finfs[k] = finfs[k - 1];
+        npows[k] = npows[k - 1];
+        continue;
+      }
+      err = Util_TableGetReal(tables[k], &finfs[k], "FINF");
+      if (err == UTIL_ERROR_BAD_HANDLE) {
+        CCTK_VWarn(5, __LINE__, __FILE__, CCTK_THORNSTRING,
+                   "Invalid table handle passed for Robin boundary "
+                   "conditions for %s.  Using all default values.",
+                   CCTK_VarName(vars[k]));
+      } else {
+        Util_TableGetInt(tables[k], &npows[k], "DECAY_POWER");
+      }
     }
 
     /* Determine boundary width on all faces */
@@ -163,12 +171,18 @@ CCTK_INT Bndry_Robin(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
                    "Error %d when reading boundary width array from table "
                    "for %s",
                    err, CCTK_VarName(vars[i]));
+        free(width_alldirs);
+        free(finfs);
+        free(npows);
         return -21;
       } else if (err != 2 * gdim) {
         CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
                    "Boundary width array for %s has %d elements, but %d "
                    "expected",
                    CCTK_VarName(vars[i]), err, 2 * gdim);
+        free(width_alldirs);
+        free(finfs);
+        free(npows);
         return -22;
       }
     } else {
@@ -178,8 +192,8 @@ CCTK_INT Bndry_Robin(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
     }
 
     /* Apply the boundary condition */
-    if ((retval = ApplyBndRobin(GH, width_alldirs, finf, npow, vars[i], j)) <
-        0) {
+    if ((retval = ApplyBndRobin(GH, width_alldirs, faces[i], finfs + i,
+                                npows + i, vars[i], j)) < 0) {
       CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
                  "ApplyBndRobin() returned %d", retval);
     }
@@ -188,6 +202,8 @@ CCTK_INT Bndry_Robin(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
   printf("BndRobin(): returning %d\n", retval);
 #endif
   free(width_alldirs);
+  free(finfs);
+  free(npows);
 
   return retval;
 }
@@ -261,6 +277,147 @@ CCTK_INT Bndry_Robin(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
         (cctk_type)((2 * aux * finf + data[src] * (1 - aux)) / (1 + aux));     \
   }
 
+/*@@
+   @routine    ROBIN_INNER_PLANE
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Macro to apply Robin boundary conditions to the second
+               boundary layer within the z plane k, for boundary widths
+               of 2.  ROBIN_BOUNDARY loops over the planes with or
+               without threads.
+   @enddesc
+   @calls      SET_LINEAR_INDICES
+               ROBIN_BOUNDARY_TYPED_3D
+
+   @var        cctk_type
+   @vdesc      CCTK datatype of the variable
+   @vtype      <cctk_type>
+   @vio        in
+   @endvar
+@@*/
+#define ROBIN_INNER_PLANE(cctk_type)                                           \
+  {                                                                            \
+    int i, j, dx, dy, dz, src, dst;                                            \
+    double distance;                                                           \
+                                                                               \
+    dz = 0;                                                                    \
+    if (k == 1 && doBC[4]) {                                                   \
+      dz = +1;                                                                 \
+    } else if (k == GH->cctk_lsh[2] - 2 && doBC[5]) {                          \
+      dz = -1;                                                                 \
+    }                                                                          \
+                                                                               \
+    /* middle loop over all y points */                                        \
+    for (j = 1; j < GH->cctk_lsh[1] - 1; j++) {                                \
+      dy = 0;                                                                  \
+      if (j == 1 && doBC[2]) {                                                 \
+        dy = +1;                                                               \
+      } else if (j == GH->cctk_lsh[1] - 2 && doBC[3]) {                        \
+        dy = -1;                                                               \
+      }                                                                        \
+                                                                               \
+      /* lower x */                                                            \
+      dx = 0;                                                                  \
+      if (doBC[0]) {                                                           \
+        dx = +1;                                                               \
+      }                                                                        \
+      if (dx || dy || dz) {                                                    \
+        SET_LINEAR_INDICES(1);                                                 \
+        ROBIN_BOUNDARY_TYPED_3D(cctk_type);                                    \
+      }                                                                        \
+                                                                               \
+      /* lower/upper y and/or z */                                             \
+      if (dy || dz) {                                                          \
+        dx = 0;                                                                \
+        SET_LINEAR_INDICES(2);                                                 \
+        for (i = 2; i < GH->cctk_lsh[0] - 2; i++, src++, dst++) {              \
+          ROBIN_BOUNDARY_TYPED_3D(cctk_type);                                  \
+        }                                                                      \
+      }                                                                        \
+                                                                               \
+      /* upper x */                                                            \
+      dx = 0;                                                                  \
+      if (doBC[1]) {                                                           \
+        dx = -1;                                                               \
+      }                                                                        \
+      if (dx || dy || dz) {                                                    \
+        SET_LINEAR_INDICES(GH->cctk_lsh[0] - 2);                               \
+        ROBIN_BOUNDARY_TYPED_3D(cctk_type);                                    \
+      }                                                                        \
+    }                                                                          \
+  }
+
+/*@@
+   @routine    ROBIN_OUTER_PLANE
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Macro to apply Robin boundary conditions to the outermost
+               boundary layer within the z plane k.  ROBIN_BOUNDARY
+               loops over the planes with or without threads.
+   @enddesc
+   @calls      SET_LINEAR_INDICES
+               ROBIN_BOUNDARY_TYPED_3D
+
+   @var        cctk_type
+   @vdesc      CCTK datatype of the variable
+   @vtype      <cctk_type>
+   @vio        in
+   @endvar
+@@*/
+#define ROBIN_OUTER_PLANE(cctk_type)                                           \
+  {                                                                            \
+    int i, j, dx, dy, dz, src, dst;                                            \
+    double distance;                                                           \
+                                                                               \
+    dz = 0;                                                                    \
+    if (k == 0 && doBC[4]) {                                                   \
+      dz = +1;                                                                 \
+    } else if (k == GH->cctk_lsh[2] - 1 && doBC[5]) {                          \
+      dz = -1;                                                                 \
+    }                                                                          \
+                                                                               \
+    /* middle loop over all y points */                                        \
+    for (j = 0; j < GH->cctk_lsh[1]; j++) {                                    \
+      dy = 0;                                                                  \
+      if (j == 0 && doBC[2]) {                                                 \
+        dy = +1;                                                               \
+      } else if (j == GH->cctk_lsh[1] - 1 && doBC[3]) {                        \
+        dy = -1;                                                               \
+      }                                                                        \
+                                                                               \
+      /* lower x */                                                            \
+      dx = 0;                                                                  \
+      if (doBC[0]) {                                                           \
+        dx = +1;                                                               \
+      }                                                                        \
+      if (dx || dy || dz) {                                                    \
+        SET_LINEAR_INDICES(0);                                                 \
+        ROBIN_BOUNDARY_TYPED_3D(cctk_type);                                    \
+      }                                                                        \
+                                                                               \
+      /* lower/upper y and/or z */                                             \
+      if (dy || dz) {                                                          \
+        dx = 0;                                                                \
+        SET_LINEAR_INDICES(1);                                                 \
+        for (i = 1; i < GH->cctk_lsh[0] - 1; i++, src++, dst++) {              \
+          ROBIN_BOUNDARY_TYPED_3D(cctk_type);                                  \
+        }                                                                      \
+      }                                                                        \
+                                                                               \
+      /* upper x */                                                            \
+      dx = 0;                                                                  \
+      if (doBC[1]) {                                                           \
+        dx = -1;                                                               \
+      }                                                                        \
+      if (dx || dy || dz) {                                                    \
+        SET_LINEAR_INDICES(GH->cctk_lsh[0] - 1);                               \
+        ROBIN_BOUNDARY_TYPED_3D(cctk_type);                                    \
+      }                                                                        \
+    }                                                                          \
+  }
+
 /*@@
    @routine    ROBIN_BOUNDARY
    @date       Thu 7 June 2001
@@ -269,9 +426,12 @@ CCTK_INT Bndry_Robin(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
                Macro to apply Robin boundary conditions to a variable
                of a given datatype in all directions
                Currently it is limited up to 3D variables only.
+
+               The z planes of each pass are spread over OpenMP threads,
+               and a serial call does not enter a parallel region.
    @enddesc
-   @calls      SET_LINEAR_INDICES
-               ROBIN_BOUNDARY_TYPED_3D
+   @calls      ROBIN_INNER_PLANE
+               ROBIN_OUTER_PLANE
 
    @var        cctk_type
    @vdesc      CCTK datatype of the variable
@@ -281,10 +441,14 @@ CCTK_INT Bndry_Robin(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
 @@*/
 #define ROBIN_BOUNDARY(cctk_type)                                              \
   {                                                                            \
-    int i, j, k;                                                               \
-    int dx, dy, dz;                                                            \
-    int src, dst;                                                              \
-    double distance;                                                           \
+    int k;                                                                     \
+    /* each point reads its inner neighbour, which the same pass only writes   \
+       if the grid is so small that boundary layers touch (lsh == 4) */        \
+    const int _use_threads =                                                   \
+        GH->cctk_lsh[0] > 4 && GH->cctk_lsh[1] > 4 && GH->cctk_lsh[2] > 4 &&   \
+        BndUseThreads2(2 * (GH->cctk_lsh[0] * GH->cctk_lsh[1] +                \
+                            GH->cctk_lsh[1] * GH->cctk_lsh[2] +                \
+                            GH->cctk_lsh[0] * GH->cctk_lsh[2]));               \
                                                                                \
     /* check the dimensionality */                                             \
     if (gdim != 3) {                                                           \
@@ -294,103 +458,44 @@ CCTK_INT Bndry_Robin(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
       return (-5);                                                             \
     }                                                                          \
                                                                                \
+    /* each boundary point reads its inner neighbour, one coordinate and r     \
+       and writes itself; edges and corners are counted once per face */       \
+    {                                                                          \
+      CCTK_INT _npoints = 0;                                                   \
+      int _f;                                                                  \
+      for (_f = 0; _f < 6; _f++) {                                             \
+        if (doBC[_f]) {                                                        \
+          _npoints += in_widths[_f] * GH->cctk_lsh[(_f / 2 + 1) % 3] *         \
+                      GH->cctk_lsh[(_f / 2 + 2) % 3];                          \
+        }                                                                      \
+      }                                                                        \
+      BndCountWork2(_npoints, 2 * sizeof(cctk_type) + 2 * sizeof(CCTK_REAL),   \
+                    15);                                                       \
+    }                                                                          \
+                                                                               \
     if (in_widths[0] == 2 || in_widths[1] == 2 || in_widths[2] == 2) {         \
       /* outermost loop over almost all z points */                            \
-      for (k = 1; k < GH->cctk_lsh[2] - 1; k++) {                              \
-        dz = 0;                                                                \
-        if (k == 1 && doBC[4]) {                                               \
-          dz = +1;                                                             \
-        } else if (k == GH->cctk_lsh[2] - 2 && doBC[5]) {                      \
-          dz = -1;                                                             \
+      if (_use_threads) {                                                      \
+        _Pragma("omp parallel for schedule(static)")                           \
+        for (k = 1; k < GH->cctk_lsh[2] - 1; k++) {                            \
+          ROBIN_INNER_PLANE(cctk_type);                                        \
         }                                                                      \
-                                                                               \
-        /* middle loop over all y points */                                    \
-        for (j = 1; j < GH->cctk_lsh[1] - 1; j++) {                            \
-          dy = 0;                                                              \
-          if (j == 1 && doBC[2]) {                                             \
-            dy = +1;                                                           \
-          } else if (j == GH->cctk_lsh[1] - 2 && doBC[3]) {                    \
-            dy = -1;                                                           \
-          }                                                                    \
-                                                                               \
-          /* lower x */                                                        \
-          dx = 0;                                                              \
-          if (doBC[0]) {                                                       \
-            dx = +1;                                                           \
-          }                                                                    \
-          if (dx || dy || dz) {                                                \
-            SET_LINEAR_INDICES(1);                                             \
-            ROBIN_BOUNDARY_TYPED_3D(cctk_type);                                \
-          }                                                                    \
-                                                                               \
-          /* lower/upper y and/or z */                                         \
-          if (dy || dz) {                                                      \
-            dx = 0;                                                            \
-            SET_LINEAR_INDICES(2);                                             \
-            for (i = 2; i < GH->cctk_lsh[0] - 2; i++, src++, dst++) {          \
-              ROBIN_BOUNDARY_TYPED_3D(cctk_type);                              \
-            }                                                                  \
-          }                                                                    \
-                                                                               \
-          /* upper x */                                                        \
-          dx = 0;                                                              \
-          if (doBC[1]) {                                                       \
-            dx = -1;                                                           \
-          }                                                                    \
-          if (dx || dy || dz) {                                                \
-            SET_LINEAR_INDICES(GH->cctk_lsh[0] - 2);                           \
-            ROBIN_BOUNDARY_TYPED_3D(cctk_type);                                \
-          }                                                                    \
+      } else {                                                                 \
+        for (k = 1; k < GH->cctk_lsh[2] - 1; k++) {                            \
+          ROBIN_INNER_PLANE(cctk_type);                                        \
         }                                                                      \
       }                                                                        \
     }                                                                          \
                                                                                \
     /* outermost loop over all z points */                                     \
-    for (k = 0; k < GH->cctk_lsh[2]; k++) {                                    \
-      dz = 0;                                                                  \
-      if (k == 0 && doBC[4]) {                                                 \
-        dz = +1;                                                               \
-      } else if (k == GH->cctk_lsh[2] - 1 && doBC[5]) {                        \
-        dz = -1;                                                               \
+    if (_use_threads) {                                                        \
+      _Pragma("omp parallel for schedule(static)")                             \
+      for (k = 0; k < GH->cctk_lsh[2]; k++) {                                  \
+        ROBIN_OUTER_PLANE(cctk_type);                                          \
       }                                                                        \
-                                                                               \
-      /* middle loop over all y points */                                      \
-      for (j = 0; j < GH->cctk_lsh[1]; j++) {                                  \
-        dy = 0;                                                                \
-        if (j == 0 && doBC[2]) {                                               \
-          dy = +1;                                                             \
-        } else if (j == GH->cctk_lsh[1] - 1 && doBC[3]) {                      \
-          dy = -1;                                                             \
-        }                                                                      \
-                                                                               \
-        /* lower x */                                                          \
-        dx = 0;                                                                \
-        if (doBC[0]) {                                                         \
-          dx = +1;                                                             \
-        }                                                                      \
-        if (dx || dy || dz) {                                                  \
-          SET_LINEAR_INDICES(0);                                               \
-          ROBIN_BOUNDARY_TYPED_3D(cctk_type);                                  \
-        }                                                                      \
-                                                                               \
-        /* lower/upper y and/or z */                                           \
-        if (dy || dz) {                                                        \
-          dx = 0;                                                              \
-          SET_LINEAR_INDICES(1);                                               \
-          for (i = 1; i < GH->cctk_lsh[0] - 1; i++, src++, dst++) {            \
-            ROBIN_BOUNDARY_TYPED_3D(cctk_type);                                \
-          }                                                                    \
-        }                                                                      \
-                                                                               \
-        /* upper x */                                                          \
-        dx = 0;                                                                \
-        if (doBC[1]) {                                                         \
-          dx = -1;                                                             \
-        }                                                                      \
-        if (dx || dy || dz) {                                                  \
-          SET_LINEAR_INDICES(GH->cctk_lsh[0] - 1);                             \
-          ROBIN_BOUNDARY_TYPED_3D(cctk_type);                                  \
-        }                                                                      \
+    } else {                                                                   \
+      for (k = 0; k < GH->cctk_lsh[2]; k++) {                                  \
+        ROBIN_OUTER_PLANE(cctk_type);                                          \
       }                                                                        \
     }                                                                          \
   }
@@ -419,14 +524,21 @@ CCTK_INT Bndry_Robin(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
    @vtype      CCTK_INT [ dimension of variable ]
    @vio        in
    @endvar
-   @var        finf
-   @vdesc      value of f at infinity
-   @vtype      CCTK_REAL
+   @var        faces
+   @vdesc      set of faces to which to apply the bc; edges and corners
+               only get the diagonal treatment if all faces meeting
+               there are selected
+   @vtype      CCTK_INT
    @vio        in
    @endvar
-   @var        npow
-   @vdesc      power of decay rate
-   @vtype      int
+   @var        finfs
+   @vdesc      value of f at infinity, for each variable
+   @vtype      const CCTK_REAL [ num_vars ]
+   @vio        in
+   @endvar
+   @var        npows
+   @vdesc      power of decay rate, for each variable
+   @vtype      const CCTK_INT [ num_vars ]
    @vio        in
    @endvar
    @var        first_var
@@ -443,11 +555,29 @@ CCTK_INT Bndry_Robin(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
    @calls      CCTK_VarTypeI
                CCTK_GroupDimFromVarI
                ROBIN_BOUNDARY
+               BndUseThreads2
+               BndCountWork2
    @history
    @hdate      Tue 10 Apr 2001
    @hauthor    Thomas Radke
    @hdesc      Merged separate routines for 1D, 2D, and 3D
                into a single generic routine
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Spread the z planes over OpenMP threads
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Honor the faces specification
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Record the modelled memory traffic and flops of each variable
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Take the value at infinity and the decay power per variable
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Enter a parallel region only when the loop is threaded, as
+               the serial cost of entering one is that of a small face
    @endhistory
 
    @returntype int
@@ -462,8 +592,8 @@ CCTK_INT Bndry_Robin(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
    @endreturndesc
 @@*/
 static int ApplyBndRobin(const cGH *GH, const CCTK_INT *in_widths,
-                         CCTK_REAL finf, int npow, int first_var,
-                         int num_vars) {
+                         CCTK_INT faces, const CCTK_REAL *finfs,
+                         const CCTK_INT *npows, int first_var, int num_vars) {
   int var, vtype, dim, gdim;
   int doBC[2 * MAXDIM];
   CCTK_INT symtable;
@@ -471,6 +601,7 @@ static int ApplyBndRobin(const cGH *GH, const CCTK_INT *in_widths,
   CCTK_INT is_physical[2 * MAXDIM];
   CCTK_INT ierr;
   char coord_system_name[20];
+  CCTK_REAL finf;
   double decay;
   const CCTK_REAL *x, *y, *z, *r;
   double dist[8];
@@ -536,9 +667,6 @@ static int ApplyBndRobin(const cGH *GH, const CCTK_INT *in_widths,
     is_physical[dim] = symbnd[dim] < 0;
   }
 
-  /* get the decay rate as a double */
-  decay = (double)npow;
-
   /* precompute the distance to all 8 neighbors in a 3D grid */
   dist[0] = 0; /* not used */
   dist[1] = GH->cctk_delta_space[0] / GH->cctk_levfac[0];
@@ -551,13 +679,18 @@ static int ApplyBndRobin(const cGH *GH, const CCTK_INT *in_widths,
 
   /* now loop over all variables */
   for (var = first_var; var < first_var + num_vars; var++) {
+    finf = finfs[var - first_var];
+    /* get the decay rate as a double */
+    decay = (double)npows[var - first_var];
+
     /* Apply condition if:
        + boundary is a physical boundary
        + boundary is an outer boundary
        + have enough grid points
     */
     for (dim = 0; dim < 2 * gdim; dim++) {
-      doBC[dim] = is_physical[dim];
+      doBC[dim] = is_physical[dim] &&
+                  (faces == CCTK_ALL_FACES || (faces & (1 << dim)));
     }
     for (dim = 0; dim < gdim; dim++) {
       doBC[dim * 2] &= GH->cctk_lsh[dim] > 1 && GH->cctk_bbox[dim * 2];
@@ -27,7 +27,7 @@
 static int ApplyBndScalar(const cGH *GH,
                           CCTK_INT width_dir, const CCTK_INT *in_widths,
                           int dir, CCTK_INT faces,
-                          CCTK_REAL scalar, int first_var, int num_vars);
+                          const CCTK_REAL *scalar, int first_var, int num_vars);
 
 /********************************************************************
  ********************    External Routines   ************************
@@ -74,6 +74,13 @@ static int ApplyBndScalar(const cGH *GH,
    @vtype      int
    @vio        in
    @endvar
+   @history
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Read SCALAR for every variable, so that variables
+               with their own tables but the same width are handled in
+               one call
+   @endhistory
    @returntype int
    @returndesc
                return code of @seeroutine ApplyBndScalar
@@ -88,44 +95,51 @@ CCTK_INT Bndry_Scalar(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
   /* variables to pass to ApplyBndScalar */
   CCTK_INT *width_alldirs; /* width of stencil in all directions */
   int dir;                 /* direction in which to apply bc */
-  CCTK_REAL scalar;
+  CCTK_REAL *scalars;      /* SCALAR of every variable */
 
   retval = 0;
   width_alldirs = NULL;
   max_gdim = 0;
+  scalars = (CCTK_REAL *)malloc(num_vars * sizeof(CCTK_REAL));
 
   /* loop through variables, j at a time */
   for (i = 0; i < num_vars; i += j) {
     /* find other adjacent vars which are selected for identical bcs */
     j = 1;
-    /* Since GFs are allowed to have different staggering, the best we
-       can do is find variables of the same group which are selected
-       for identical bcs.  If all GFs had the same staggering then we
-       could groups many GFs together. */
+    /* GFs are allowed to have different staggering, so only variables
+       of one group, or of groups with the same shape and staggering,
+       which are selected for identical bcs are handled together (see
+       BndCanBatchVars2).  Their tables may differ unless the boundary
+       width is taken from the table. */
     gi = CCTK_GroupIndexFromVarI(vars[i]);
     while (i + j < num_vars && vars[i + j] == vars[i] + j &&
-           CCTK_GroupIndexFromVarI(vars[i + j]) == gi &&
-           tables[i + j] == tables[i] && faces[i + j] == faces[i] &&
-           widths[i + j] == widths[i]) {
+           BndCanBatchVars2(GH, vars[i], vars[i + j]) &&
+           (tables[i + j] == tables[i] || widths[i] >= 0) &&
+           faces[i + j] == faces[i] && widths[i + j] == widths[i]) {
       ++j;
     }
 
     dir = 0; /* apply bc to all faces */
 
-    /* Set up default arguments for ApplyBndScalar */
-    scalar = 0.;
-
-    /* Look on table for possible non-default arguments
+    /* Look on the table of each variable for possible non-default
+     * arguments
      * (If any of these table look-ups fail, the value will be unchanged
      * from its default value)
      */
-    /* Scalar value */
-    err = Util_TableGetReal(tables[i], &scalar, "SCALAR");
-    if (err == UTIL_ERROR_BAD_HANDLE) {
-      CCTK_VWarn(5, __LINE__, __FILE__, CCTK_THORNSTRING,
-                 "Invalid table handle passed for Scalar boundary "
-                 "conditions for %s.  Using all default values.",
-                 CCTK_VarName(vars[i]));
+    for (k = i; k < i + j; k++) {
+      /* Scalar value */
+      scalars[k] = 0.;
+      if (k > i && tables[k] == tables[k - 1]) {
+        scalars[k] = scalars[k - 1];
+        continue;
+      }
+      err = Util_TableGetReal(tables[k], &scalars[k], "SCALAR");
+      if (err == UTIL_ERROR_BAD_HANDLE) {
+        CCTK_VWarn(5, __LINE__, __FILE__, CCTK_THORNSTRING,
+                   "Invalid table handle passed for Scalar boundary "
+                   "conditions for %s.  Using all default values.",
+                   CCTK_VarName(vars[k]));
+      }
     }
 
     /* Determine boundary width on all faces */
@@ -147,12 +161,16 @@ CCTK_INT Bndry_Scalar(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
                    "Error %d when reading boundary width array from table "
                    "for %s",
                    err, CCTK_VarName(vars[i]));
+        free(width_alldirs);
+        free(scalars);
         return -21;
       } else if (err != 2 * gdim) {
         CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
                    "Boundary width array for %s has %d elements, but %d "
                    "expected",
                    CCTK_VarName(vars[i]), err, 2 * gdim);
+        free(width_alldirs);
+        free(scalars);
         return -22;
       }
     } else {
@@ -162,8 +180,8 @@ CCTK_INT Bndry_Scalar(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
     }
 
     /* Apply the boundary condition */
-    if ((retval = ApplyBndScalar(GH, 0, width_alldirs, dir, faces[i], scalar,
-                                 vars[i], j)) < 0) {
+    if ((retval = ApplyBndScalar(GH, 0, width_alldirs, dir, faces[i],
+                                 scalars + i, vars[i], j)) < 0) {
       CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
                  "ApplyBndScalar() returned %d", retval);
     }
@@ -173,6 +191,7 @@ CCTK_INT Bndry_Scalar(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
 #endif
 
   free(width_alldirs);
+  free(scalars);
 
   return retval;
 }
@@ -187,104 +206,115 @@ CCTK_INT Bndry_Scalar(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
 /* macro to compute the linear index of a 3D point */
 #define INDEX_3D(ash, i, j, k) ((i) + (ash)[0] * ((j) + (ash)[1] * (k)))
 
-/* an empty macro */
-#define NOTHING
-
 /*@@
-   @routine    SCALAR_BOUNDARY_TYPED
-   @date       Sat 20 Jan 2001
-   @author     Thomas Radke
+   @routine    SCALAR_VALUE
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
    @desc
-               Macro to apply scalar boundary conditions to a variable
-               of given datatype
-               Currently it is limited up to 3D variables only.
+               Macro to convert the scalar of each variable into the
+               datatype of the variables, storing it in values[]
    @enddesc
 
-   @var        doBC
-   @vdesc      flag telling whether to apply boundary conditions or not
-   @vtype      int
-   @vio        in
-   @endvar
-   @var        iend, jend, kend
-   @vdesc      upper ranges for the loopers
-   @vtype      int
+   @var        left_cctk_type
+   @vdesc      CCTK datatype of the variable
+   @vtype      <cctk_type>
    @vio        in
    @endvar
-   @var        ii, jj, kk
-   @vdesc      indices of the current grid point
-   @vtype      int
+   @var        right_cctk_type
+   @vdesc      CCTK datatype the scalar is cast to before assignment
+   @vtype      <cctk_type>
    @vio        in
    @endvar
+@@*/
+#define SCALAR_VALUE(left_cctk_type, right_cctk_type)                          \
+  {                                                                            \
+    for (i = 0; i < num_vars; i++) {                                           \
+      *(left_cctk_type *)&values[i] = (right_cctk_type)scalar[i];              \
+    }                                                                          \
+  }
+
+/*@@
+   @routine    SCALAR_ROWS
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Macro to set the rows of the boundary zones of both faces
+               of direction d to the scalar of their variable, with the
+               rows shared out among OpenMP threads.  The scalar is read
+               once per row as the type of the variables and stored
+               through a pointer of that type, so that the row loop is
+               a vectorised broadcast store.
+   @enddesc
+
    @var        cctk_type
-   @vdesc      CCTK datatype of the variable
+   @vdesc      CCTK datatype of the variables
    @vtype      <cctk_type>
    @vio        in
    @endvar
 @@*/
-#define SCALAR_BOUNDARY_TYPED(doBC, iend, jend, kend, ii, jj, kk,              \
-                              left_cctk_type, right_cctk_type)                 \
+/* rows shorter than this are not worth the set-up of a vector loop */
+#define SCALAR_SHORT_ROW 8
+
+#define SCALAR_ROWS(cctk_type)                                                 \
   {                                                                            \
-    if (doBC) {                                                                \
-      for (k = 0; k < kend; k++) {                                             \
-        for (j = 0; j < jend; j++) {                                           \
-          for (i = 0; i < iend; i++) {                                         \
-            int _index;                                                        \
+    BndRow2 _row;                                                              \
+    int _n = BndRowsShare2(&rows, threaded, &_row);                            \
+                                                                               \
+    while (_n > 0) {                                                           \
+      const int _nrows = _n < BND_PLANE_ROWS2(rows, _row)                      \
+                             ? _n : BND_PLANE_ROWS2(rows, _row);               \
+      const int _nx = extent[2 * d + _row.upper][0];                           \
+      const cctk_type _value = *(const cctk_type *)&values[_row.var];          \
+      int _to[MAXDIM], _jj, _ii;                                               \
+      cctk_type *_data;                                                        \
                                                                                \
-            _index = INDEX_3D(ash, ii, jj, kk);                                \
-            ((left_cctk_type *)GH->data[var][timelvl])[_index] =               \
-                (right_cctk_type)scalar;                                       \
+      _to[0] = 0;                                                              \
+      _to[1] = _row.j;                                                         \
+      _to[2] = _row.k;                                                         \
+      /* the order of the points does not matter, so the zone of an upper      \
+         face is traversed outwards like that of a lower one */                \
+      if (_row.upper) {                                                        \
+        _to[d] += lsh[d] - extent[2 * d + 1][d];                               \
+      }                                                                        \
+      _data = (cctk_type *)GH->data[first_var + _row.var][timelvl] +           \
+              INDEX_3D(ash, _to[0], _to[1], _to[2]);                           \
+      if (_nx < SCALAR_SHORT_ROW) {                                            \
+        /* the rows of an x face are as long as its width */                   \
+        for (_jj = 0; _jj < _nrows; _jj++, _data += ash[0]) {                  \
+          for (_ii = 0; _ii < _nx; _ii++) {                                    \
+            _data[_ii] = _value;                                               \
+          }                                                                    \
+        }                                                                      \
+      } else {                                                                 \
+        for (_jj = 0; _jj < _nrows; _jj++, _data += ash[0]) {                  \
+          _Pragma("omp simd")                                                  \
+          for (_ii = 0; _ii < _nx; _ii++) {                                    \
+            _data[_ii] = _value;                                               \
           }                                                                    \
         }                                                                      \
       }                                                                        \
+      _n -= _nrows;                                                            \
+      BND_NEXT_PLANE2(rows, _row);                                             \
     }                                                                          \
   }
 
 /*@@
-   @routine    SCALAR_BOUNDARY
-   @date       Sat 20 Jan 2001
-   @author     Thomas Radke
+   @routine    SCALAR_APPLY
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
    @desc
-               Macro to apply scalar boundary conditions to a variable
-               of a given datatype in all directions
-               Currently it is limited up to 3D variables only.
+               Macro to run SCALAR_ROWS for the variables' datatype, in
+               a parallel region if threaded
    @enddesc
 
    @var        cctk_type
-   @vdesc      CCTK datatype of the variable
+   @vdesc      CCTK datatype of the variables
    @vtype      <cctk_type>
    @vio        in
    @endvar
 @@*/
-#define SCALAR_BOUNDARY(left_cctk_type, right_cctk_type)                       \
-  {                                                                            \
-    /* now set the boundaries face by face */                                  \
-    if (gdim > 0) {                                                            \
-      /* lower x */                                                            \
-      SCALAR_BOUNDARY_TYPED(doBC[0], widths[0], lsh[1], lsh[2], i, j, k,       \
-                            left_cctk_type, right_cctk_type);                  \
-      /* upper x */                                                            \
-      SCALAR_BOUNDARY_TYPED(doBC[1], widths[1], lsh[1], lsh[2],                \
-                            lsh[0] - i - 1, j, k, left_cctk_type,              \
-                            right_cctk_type);                                  \
-    }                                                                          \
-    if (gdim > 1) {                                                            \
-      /* lower y */                                                            \
-      SCALAR_BOUNDARY_TYPED(doBC[2], lsh[0], widths[2], lsh[2], i, j, k,       \
-                            left_cctk_type, right_cctk_type);                  \
-      /* upper y */                                                            \
-      SCALAR_BOUNDARY_TYPED(doBC[3], lsh[0], widths[3], lsh[2], i,             \
-                            lsh[1] - j - 1, k, left_cctk_type,                 \
-                            right_cctk_type);                                  \
-    }                                                                          \
-    if (gdim > 2) {                                                            \
-      /* lower z */                                                            \
-      SCALAR_BOUNDARY_TYPED(doBC[4], lsh[0], lsh[1], widths[4], i, j, k,       \
-                            left_cctk_type, right_cctk_type);                  \
-      /* upper z */                                                            \
-      SCALAR_BOUNDARY_TYPED(doBC[5], lsh[0], lsh[1], widths[5], i, j,          \
-                            lsh[2] - k - 1, left_cctk_type, right_cctk_type);  \
-    }                                                                          \
-  }
+#define SCALAR_APPLY(cctk_type)                                                \
+  BND_PARALLEL_IF2(threaded, SCALAR_ROWS(cctk_type))
 
 /*@@
   @routine    ApplyBndScalar
@@ -301,7 +331,11 @@ CCTK_INT Bndry_Scalar(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
   @enddesc
   @calls      CCTK_VarTypeI
               CCTK_GroupDimFromVarI
-              SCALAR_BOUNDARY
+              SCALAR_VALUE
+              BndUseThreads2
+              BndFaceRows2
+              BndRowsShare2
+              BndCountWork2
 
   @var        GH
   @vdesc      Pointer to CCTK grid hierarchy
@@ -324,8 +358,8 @@ CCTK_INT Bndry_Scalar(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
   @vio        in
   @endvar
   @var        scalar
-  @vdesc      scalar value to set the boundaries to
-  @vtype      CCTK_REAL
+  @vdesc      scalar value to set the boundaries to, for each variable
+  @vtype      const CCTK_REAL [ num_vars ]
   @vio        in
   @endvar
   @var        first_var
@@ -344,6 +378,30 @@ CCTK_INT Bndry_Scalar(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
   @hauthor    Thomas Radke
   @hdesc      Merged separate routines for 1D, 2D, and 3D
               into a single generic routine
+  @hdate      Sun Oct 18 2026
+  @hauthor    Samuel Cupp
+  @hdesc      Convert the scalar once per call and set the boundaries in a
+              loop over (variable, face, row) work items which is spread
+              over OpenMP threads
+  @hdate      Sun Oct 18 2026
+  @hauthor    Samuel Cupp
+  @hdesc      Record the modelled memory traffic and flops of each loop
+  @hdate      Sun Oct 18 2026
+  @hauthor    Samuel Cupp
+  @hdesc      Take the scalar per variable
+  @hdate      Sun Oct 18 2026
+  @hauthor    Samuel Cupp
+  @hdesc      Select the row loop by element size once per call and step
+              through the rows of a thread without divisions
+  @hdate      Sun Oct 18 2026
+  @hauthor    Samuel Cupp
+  @hdesc      Enter a parallel region only when the loop is threaded, as
+              the serial cost of entering one is that of a small face
+  @hdate      Sun Oct 18 2026
+  @hauthor    Samuel Cupp
+  @hdesc      Select the row loop by datatype, so that the scalar is
+              stored through a typed pointer in a vectorised loop instead
+              of by memcpy
   @endhistory
 
   @returntype int
@@ -358,12 +416,22 @@ CCTK_INT Bndry_Scalar(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
 static int ApplyBndScalar(const cGH *GH,
                           CCTK_INT width_dir, const CCTK_INT *in_widths,
                           int dir, CCTK_INT faces,
-                          CCTK_REAL scalar, int first_var, int num_vars) {
+                          const CCTK_REAL *scalar, int first_var, int num_vars) {
   int ierr;
-  int i, j, k;
+  int i, d, f;
   int gindex, gdim;
-  int var, timelvl;
+  int vtype, vtypesize, timelvl;
   int doBC[2 * MAXDIM], ash[MAXDIM], lsh[MAXDIM];
+  int extent[2 * MAXDIM][MAXDIM], nrows[2 * MAXDIM];
+  union value {
+    CCTK_BYTE byte;
+    CCTK_INT int_;
+    CCTK_REAL real;
+    CCTK_COMPLEX complex;
+#ifdef HAVE_CCTK_REAL16
+    CCTK_REAL16 real16;
+#endif
+  } *values;
   CCTK_INT widths[2 * MAXDIM];
   CCTK_INT symtable;
   CCTK_INT symbnd[2 * MAXDIM];
@@ -425,102 +493,194 @@ static int ApplyBndScalar(const cGH *GH,
     is_physical[i] = symbnd[i] < 0;
   }
 
-  /* now loop over all variables */
-  for (var = first_var; var < first_var + num_vars; var++) {
-    /* Apply condition if:
-       + boundary is a physical boundary
-       + boundary is an outer boundary
-       + have enough grid points
-    */
-    for (i = 0; i < 2 * gdim; i++) {
-      doBC[i] = is_physical[i] && (faces == CCTK_ALL_FACES || (faces & (1<<i)));
+  /* Apply condition if:
+     + boundary is a physical boundary
+     + boundary is an outer boundary
+     + have enough grid points
+  */
+  for (i = 0; i < 2 * gdim; i++) {
+    doBC[i] = is_physical[i] && (faces == CCTK_ALL_FACES || (faces & (1<<i)));
+  }
+  for (i = 0; i < gdim; i++) {
+    ash[i] = GH->cctk_ash[i];
+    lsh[i] = GH->cctk_lsh[i];
+    doBC[i * 2] &= GH->cctk_lsh[i] > widths[i * 2] && GH->cctk_bbox[i * 2];
+    doBC[i * 2 + 1] &=
+        GH->cctk_lsh[i] > widths[i * 2 + 1] && GH->cctk_bbox[i * 2 + 1];
+    if (dir != 0) {
+      doBC[i * 2] &= (dir < 0 && (i + 1 == abs(dir)));
+      doBC[i * 2 + 1] &= (dir > 0 && (i + 1 == abs(dir)));
     }
-    for (i = 0; i < gdim; i++) {
-      ash[i] = GH->cctk_ash[i];
-      lsh[i] = GH->cctk_lsh[i];
-      doBC[i * 2] &= GH->cctk_lsh[i] > widths[i * 2] && GH->cctk_bbox[i * 2];
-      doBC[i * 2 + 1] &=
-          GH->cctk_lsh[i] > widths[i * 2 + 1] && GH->cctk_bbox[i * 2 + 1];
-      if (dir != 0) {
-        doBC[i * 2] &= (dir < 0 && (i + 1 == abs(dir)));
-        doBC[i * 2 + 1] &= (dir > 0 && (i + 1 == abs(dir)));
-      }
+  }
+
+  /* convert the scalars to the variables' datatype */
+  vtype = CCTK_VarTypeI(first_var);
+  vtypesize = CCTK_VarTypeSize(vtype);
+  values = (union value *)malloc(num_vars * sizeof *values);
+  switch (vtype) {
+  case CCTK_VARIABLE_BYTE:
+    SCALAR_VALUE(CCTK_BYTE, CCTK_BYTE);
+    break;
+
+  case CCTK_VARIABLE_INT:
+    SCALAR_VALUE(CCTK_INT, CCTK_INT);
+    break;
+
+  case CCTK_VARIABLE_REAL:
+    SCALAR_VALUE(CCTK_REAL, CCTK_REAL);
+    break;
+
+#ifdef HAVE_CCTK_INT1
+  case CCTK_VARIABLE_INT1:
+    SCALAR_VALUE(CCTK_INT1, CCTK_INT1);
+    break;
+#endif
+
+#ifdef HAVE_CCTK_INT2
+  case CCTK_VARIABLE_INT2:
+    SCALAR_VALUE(CCTK_INT2, CCTK_INT2);
+    break;
+#endif
+
+#ifdef HAVE_CCTK_INT4
+  case CCTK_VARIABLE_INT4:
+    SCALAR_VALUE(CCTK_INT4, CCTK_INT4);
+    break;
+#endif
+
+#ifdef HAVE_CCTK_INT8
+  case CCTK_VARIABLE_INT8:
+    SCALAR_VALUE(CCTK_INT8, CCTK_INT8);
+    break;
+#endif
+
+#ifdef HAVE_CCTK_INT16
+  case CCTK_VARIABLE_INT16:
+    SCALAR_VALUE(CCTK_INT16, CCTK_INT16);
+    break;
+#endif
+
+#ifdef HAVE_CCTK_REAL4
+  case CCTK_VARIABLE_REAL4:
+    SCALAR_VALUE(CCTK_REAL4, CCTK_REAL4);
+    break;
+#endif
+
+#ifdef HAVE_CCTK_REAL8
+  case CCTK_VARIABLE_REAL8:
+    SCALAR_VALUE(CCTK_REAL8, CCTK_REAL8);
+    break;
+#endif
+
+#ifdef HAVE_CCTK_REAL16
+  case CCTK_VARIABLE_REAL16:
+    SCALAR_VALUE(CCTK_REAL16, CCTK_REAL16);
+    break;
+#endif
+
+  case CCTK_VARIABLE_COMPLEX:
+    SCALAR_VALUE(CCTK_COMPLEX, CCTK_REAL);
+    break;
+
+  default:
+    CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+               "Unsupported variable type %d for variable '%s'",
+               vtype, CCTK_VarName(first_var));
+    free(values);
+    return (-4);
+  }
+
+  /* the boundary zone of each face is a box of extent[face][] points,
+     which is traversed in rows along the x direction */
+  for (f = 0; f < 2 * gdim; f++) {
+    for (i = 0; i < MAXDIM; i++) {
+      extent[f][i] = lsh[i];
     }
+    extent[f][f / 2] = widths[f];
+    nrows[f] = doBC[f] ? extent[f][1] * extent[f][2] : 0;
+  }
 
-    switch (CCTK_VarTypeI(var)) {
-    /* FIXME: can't pass an empty preprocessor constant as a macro argument
-              on some systems (e.g. MacOS X), so we have to define it outside */
+  /* now set the boundaries direction by direction, both faces of a
+     direction at once */
+  for (d = 0; d < gdim; d++) {
+    const int nlower = nrows[2 * d], nupper = nrows[2 * d + 1];
+    const BndRows2 rows =
+        BndFaceRows2(num_vars, nlower ? extent[2 * d] : NULL,
+                     nupper ? extent[2 * d + 1] : NULL);
+    const CCTK_INT npoints =
+        num_vars * (nlower * extent[2 * d][0] + nupper * extent[2 * d + 1][0]);
+    const int threaded = BndUseThreads2(npoints);
+
+    /* each point is only written */
+    BndCountWork2(npoints, vtypesize, 0);
+
+    switch (vtype) {
     case CCTK_VARIABLE_BYTE:
-      SCALAR_BOUNDARY(CCTK_BYTE, CCTK_BYTE);
+      SCALAR_APPLY(CCTK_BYTE);
       break;
 
     case CCTK_VARIABLE_INT:
-      SCALAR_BOUNDARY(CCTK_INT, CCTK_INT);
+      SCALAR_APPLY(CCTK_INT);
       break;
 
     case CCTK_VARIABLE_REAL:
-      SCALAR_BOUNDARY(CCTK_REAL, CCTK_REAL);
+      SCALAR_APPLY(CCTK_REAL);
       break;
 
 #ifdef HAVE_CCTK_INT1
     case CCTK_VARIABLE_INT1:
-      SCALAR_BOUNDARY(CCTK_INT1, CCTK_INT1);
+      SCALAR_APPLY(CCTK_INT1);
       break;
 #endif
 
 #ifdef HAVE_CCTK_INT2
     case CCTK_VARIABLE_INT2:
-      SCALAR_BOUNDARY(CCTK_INT2, CCTK_INT2);
+      SCALAR_APPLY(CCTK_INT2);
       break;
 #endif
 
 #ifdef HAVE_CCTK_INT4
     case CCTK_VARIABLE_INT4:
-      SCALAR_BOUNDARY(CCTK_INT4, CCTK_INT4);
+      SCALAR_APPLY(CCTK_INT4);
       break;
 #endif
 
 #ifdef HAVE_CCTK_INT8
     case CCTK_VARIABLE_INT8:
-      SCALAR_BOUNDARY(CCTK_INT8, CCTK_INT8);
+      SCALAR_APPLY(CCTK_INT8);
       break;
 #endif
 
 #ifdef HAVE_CCTK_INT16
     case CCTK_VARIABLE_INT16:
-      SCALAR_BOUNDARY(CCTK_INT16, CCTK_INT16);
+      SCALAR_APPLY(CCTK_INT16);
       break;
 #endif
 
 #ifdef HAVE_CCTK_REAL4
     case CCTK_VARIABLE_REAL4:
-      SCALAR_BOUNDARY(CCTK_REAL4, CCTK_REAL4);
+      SCALAR_APPLY(CCTK_REAL4);
       break;
 #endif
 
 #ifdef HAVE_CCTK_REAL8
     case CCTK_VARIABLE_REAL8:
-      SCALAR_BOUNDARY(CCTK_REAL8, CCTK_REAL8);
+      SCALAR_APPLY(CCTK_REAL8);
       break;
 #endif
 
 #ifdef HAVE_CCTK_REAL16
     case CCTK_VARIABLE_REAL16:
-      SCALAR_BOUNDARY(CCTK_REAL16, CCTK_REAL16);
+      SCALAR_APPLY(CCTK_REAL16);
       break;
 #endif
 
     case CCTK_VARIABLE_COMPLEX:
-      SCALAR_BOUNDARY(CCTK_COMPLEX, CCTK_REAL);
+      SCALAR_APPLY(CCTK_COMPLEX);
       break;
-
-    default:
-      CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
-                 "Unsupported variable type %d for variable '%s'",
-                 CCTK_VarTypeI(var), CCTK_VarName(var));
-      return (-4);
     }
   }
 
+  free(values);
   return (0);
 }
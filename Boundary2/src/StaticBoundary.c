@@ -95,13 +95,13 @@ CCTK_INT Bndry_Static(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
   for (i = 0; i < num_vars; i += j) {
     /* find other adjacent vars which are selected for identical bcs */
     j = 1;
-    /* Since GFs are allowed to have different staggering, the best we
-       can do is find variables of the same group which are selected
-       for identical bcs.  If all GFs had the same staggering then we
-       could groups many GFs together. */
+    /* GFs are allowed to have different staggering, so only variables
+       of one group, or of groups with the same shape and staggering,
+       which are selected for identical bcs are handled together (see
+       BndCanBatchVars2). */
     gi = CCTK_GroupIndexFromVarI(vars[i]);
     while (i + j < num_vars && vars[i + j] == vars[i] + j &&
-           CCTK_GroupIndexFromVarI(vars[i + j]) == gi &&
+           BndCanBatchVars2(GH, vars[i], vars[i + j]) &&
            tables[i + j] == tables[i] && faces[i + j] == faces[i] &&
            widths[i + j] == widths[i]) {
       ++j;
@@ -168,44 +168,62 @@ CCTK_INT Bndry_Static(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
 #define INDEX_3D(ash, i, j, k) ((i) + (ash)[0] * ((j) + (ash)[1] * (k)))
 
 /*@@
-   @routine    STATIC_BOUNDARY
-   @date       Sat 20 Jan 2001
-   @author     Thomas Radke
+   @routine    STATIC_ROWS
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
    @desc
-               Macro to apply static boundary conditions to a variable
-               Currently it is limited up to 3D variables only.
+               Macro to copy the rows of the boundary zones of both faces
+               of direction d from the previous time level, with the
+               rows shared out among OpenMP threads a plane of rows at a
+               time.  The size of an element is a constant where
+               possible, so that the copy of an element is not a call
+               to memcpy.
    @enddesc
 
-   @var        doBC
-   @vdesc      flag telling whether to apply boundary conditions or not
-   @vtype      int
-   @vio        in
-   @endvar
-   @var        iend, jend, kend
-   @vdesc      upper ranges for the loopers
-   @vtype      int
-   @vio        in
-   @endvar
-   @var        ii, jj, kk
-   @vdesc      indices of the current grid point
+   @var        size
+   @vdesc      size of an element in bytes
    @vtype      int
    @vio        in
    @endvar
 @@*/
-#define STATIC_BOUNDARY(doBC, iend, jend, kend, ii, jj, kk)                    \
+#define STATIC_ROWS(size)                                                      \
   {                                                                            \
-    if (doBC) {                                                                \
-      for (k = 0; k < kend; k++) {                                             \
-        for (j = 0; j < jend; j++) {                                           \
-          for (i = 0; i < iend; i++) {                                         \
-            int _index;                                                        \
+    BndRow2 _row;                                                              \
+    int _n = BndRowsShare2(&rows, threaded, &_row);                            \
+                                                                               \
+    while (_n > 0) {                                                           \
+      const int _nrows = _n < BND_PLANE_ROWS2(rows, _row)                      \
+                             ? _n : BND_PLANE_ROWS2(rows, _row);               \
+      const int _nx = extent[2 * d + _row.upper][0];                           \
+      const ptrdiff_t _stride = ash[0] * (size);                               \
+      int _to[MAXDIM], _jj, _ii;                                               \
+      ptrdiff_t _index;                                                        \
+      char *_to_row;                                                           \
+      const char *_from_row;                                                   \
                                                                                \
-            _index = INDEX_3D(ash, ii, jj, kk) * vtypesize;                    \
-            memcpy((char *)GH->data[var][timelvl_to] + _index,                 \
-                   (char *)GH->data[var][timelvl_from] + _index, vtypesize);   \
-          }                                                                    \
+      _to[0] = 0;                                                              \
+      _to[1] = _row.j;                                                         \
+      _to[2] = _row.k;                                                         \
+      /* the order of the points does not matter, so the zone of an upper      \
+         face is traversed outwards like that of a lower one */                \
+      if (_row.upper) {                                                        \
+        _to[d] += lsh[d] - extent[2 * d + 1][d];                               \
+      }                                                                        \
+      _index = INDEX_3D(ash, _to[0], _to[1], _to[2]) * (size);                 \
+      _to_row = (char *)GH->data[first_var + _row.var][timelvl_to];            \
+      _from_row =                                                              \
+          (const char *)GH->data[first_var + _row.var][timelvl_from];          \
+      _to_row += _index;                                                       \
+      _from_row += _index;                                                     \
+      for (_jj = 0; _jj < _nrows; _jj++) {                                     \
+        for (_ii = 0; _ii < _nx; _ii++) {                                      \
+          memcpy(_to_row + _ii * (size), _from_row + _ii * (size), (size));    \
         }                                                                      \
+        _to_row += _stride;                                                    \
+        _from_row += _stride;                                                  \
       }                                                                        \
+      _n -= _nrows;                                                            \
+      BND_NEXT_PLANE2(rows, _row);                                             \
     }                                                                          \
   }
 
@@ -258,12 +276,31 @@ CCTK_INT Bndry_Static(const cGH *GH, CCTK_INT num_vars, CCTK_INT *vars,
                CCTK_GroupDimI
                CCTK_VarTypeI
                CCTK_GroupStaggerDirArrayGI
-               STATIC_BOUNDARY
+               BndUseThreads2
+               BndFaceRows2
+               BndRowsShare2
+               BndCountWork2
    @history
    @hdate      Sat 20 Jan 2001
    @hauthor    Thomas Radke
    @hdesc      Merged separate routines for 1D, 2D, and 3D
                into a single generic routine
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Replaced the STATIC_BOUNDARY macro by a loop over
+               (variable, face, row) work items which is spread over
+               OpenMP threads
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Record the modelled memory traffic and flops of each loop
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Select the row loop by element size once per call and step
+               through the rows of a thread without divisions
+   @hdate      Sun Oct 18 2026
+   @hauthor    Samuel Cupp
+   @hdesc      Enter a parallel region only when the loop is threaded, as
+               the serial cost of entering one is that of a small face
    @endhistory
 
    @returntype int
@@ -279,11 +316,12 @@ static int ApplyBndStatic(const cGH *GH, CCTK_INT width_dir,
                           const CCTK_INT *in_widths, int dir, CCTK_INT faces,
                           int first_var, int num_vars) {
   int ierr;
-  int i, j, k;
+  int i, d, f, var;
   int timelvl_to, timelvl_from;
   int gindex, gdim;
-  int var, vtypesize;
+  int vtypesize;
   int doBC[2 * MAXDIM], ash[MAXDIM], lsh[MAXDIM];
+  int extent[2 * MAXDIM][MAXDIM], nrows[2 * MAXDIM];
   CCTK_INT widths[2 * MAXDIM];
   CCTK_INT symtable;
   CCTK_INT symbnd[2 * MAXDIM];
@@ -353,7 +391,7 @@ static int ApplyBndStatic(const cGH *GH, CCTK_INT width_dir,
     is_physical[i] = symbnd[i] < 0;
   }
 
-  /* now loop over all variables */
+  /* check the timelevels of all variables */
   for (var = first_var; var < first_var + num_vars; var++) {
     if (CCTK_ActiveTimeLevelsVI(GH, var) < 2) {
       CCTK_VWarn(0, __LINE__, __FILE__, CCTK_THORNSTRING,
@@ -361,44 +399,52 @@ static int ApplyBndStatic(const cGH *GH, CCTK_INT width_dir,
                  "active, but %s only has %d.",
                  CCTK_FullName(var), CCTK_ActiveTimeLevelsVI(GH, var));
     }
-    /* Apply condition if:
-       + boundary is an outer boundary
-       + have enough grid points
-    */
-    for (i = 0; i < 2 * gdim; i++) {
-      doBC[i] = is_physical[i] && (faces == CCTK_ALL_FACES || (faces & (1<<i)));
-    }
-    for (i = 0; i < gdim; i++) {
-      ash[i] = GH->cctk_ash[i];
-      lsh[i] = GH->cctk_lsh[i];
-      doBC[i * 2] &= GH->cctk_lsh[i] > widths[i * 2] && GH->cctk_bbox[i * 2];
-      doBC[i * 2 + 1] &=
-          GH->cctk_lsh[i] > widths[i * 2 + 1] && GH->cctk_bbox[i * 2 + 1];
-      if (dir != 0) {
-        doBC[i * 2] &= (dir < 0 && (i + 1 == abs(dir)));
-        doBC[i * 2 + 1] &= (dir > 0 && (i + 1 == abs(dir)));
-      }
-    }
+  }
 
-    /* now copy the boundaries face by face */
-    if (gdim > 0) {
-      /* lower x */
-      STATIC_BOUNDARY(doBC[0], widths[0], lsh[1], lsh[2], i, j, k);
-      /* upper x */
-      STATIC_BOUNDARY(doBC[1], widths[1], lsh[1], lsh[2], lsh[0] - i - 1, j, k);
-    }
-    if (gdim > 1) {
-      /* lower y */
-      STATIC_BOUNDARY(doBC[2], lsh[0], widths[2], lsh[2], i, j, k);
-      /* upper y */
-      STATIC_BOUNDARY(doBC[3], lsh[0], widths[3], lsh[2], i, lsh[1] - j - 1, k);
+  /* Apply condition if:
+     + boundary is an outer boundary
+     + have enough grid points
+  */
+  for (i = 0; i < 2 * gdim; i++) {
+    doBC[i] = is_physical[i] && (faces == CCTK_ALL_FACES || (faces & (1<<i)));
+  }
+  for (i = 0; i < gdim; i++) {
+    ash[i] = GH->cctk_ash[i];
+    lsh[i] = GH->cctk_lsh[i];
+    doBC[i * 2] &= GH->cctk_lsh[i] > widths[i * 2] && GH->cctk_bbox[i * 2];
+    doBC[i * 2 + 1] &=
+        GH->cctk_lsh[i] > widths[i * 2 + 1] && GH->cctk_bbox[i * 2 + 1];
+    if (dir != 0) {
+      doBC[i * 2] &= (dir < 0 && (i + 1 == abs(dir)));
+      doBC[i * 2 + 1] &= (dir > 0 && (i + 1 == abs(dir)));
     }
-    if (gdim > 2) {
-      /* lower z */
-      STATIC_BOUNDARY(doBC[4], lsh[0], lsh[1], widths[4], i, j, k);
-      /* upper z */
-      STATIC_BOUNDARY(doBC[5], lsh[0], lsh[1], widths[5], i, j, lsh[2] - k - 1);
+  }
+
+  /* the boundary zone of each face is a box of extent[face][] points,
+     which is traversed in rows along the x direction */
+  for (f = 0; f < 2 * gdim; f++) {
+    for (i = 0; i < MAXDIM; i++) {
+      extent[f][i] = lsh[i];
     }
+    extent[f][f / 2] = widths[f];
+    nrows[f] = doBC[f] ? extent[f][1] * extent[f][2] : 0;
+  }
+
+  /* now copy the boundaries direction by direction, both faces of a
+     direction at once */
+  for (d = 0; d < gdim; d++) {
+    const int nlower = nrows[2 * d], nupper = nrows[2 * d + 1];
+    const CCTK_INT npoints =
+        num_vars * (nlower * extent[2 * d][0] + nupper * extent[2 * d + 1][0]);
+    const BndRows2 rows =
+        BndFaceRows2(num_vars, nlower ? extent[2 * d] : NULL,
+                     nupper ? extent[2 * d + 1] : NULL);
+    const int threaded = BndUseThreads2(npoints);
+
+    /* each point reads the previous time level and writes the current one */
+    BndCountWork2(npoints, 2 * vtypesize, 0);
+
+    BND_PARALLEL_IF2(threaded, BND_SWITCH_SIZE2(vtypesize, STATIC_ROWS));
   }
 
   return (0);
@@ -0,0 +1,311 @@
+/*@@
+  @file      TaskPool.cc
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Work-stealing task pool for boundary tasks.
+
+             The pool starts its threads when it is first used and
+             keeps them asleep between calls, so that neither a sync
+             nor a background application pays for creating threads.
+             Together with the calling thread it has as many threads as
+             OpenMP uses, and kernels run serially inside its tasks, so
+             that a boundary task never adds threads of its own. Each
+             thread owns a deque of tasks, threads which are not part
+             of the pool share the first one. Tasks are dealt out
+             largest first, owners take from the front of their own
+             deque and idle threads steal from the back of the others.
+  @enddesc
+  @version   $Header$
+@@*/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "cctk.h"
+#include "cctk_Arguments.h"
+#include "cctk_Parameters.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "Boundary2.h"
+#include "TaskPool.h"
+
+namespace Boundary2 {
+
+/* set while a thread executes pool tasks, see BndInTaskPool2 */
+static thread_local bool in_pool = false;
+
+/* the deque a thread owns, 0 for threads which are not in the pool */
+static thread_local int queue_id = 0;
+
+class TaskPool {
+public:
+  explicit TaskPool(int nworkers);
+  ~TaskPool();
+
+  void run(std::vector<BndTask> &tasks, int nthreads);
+  void start(std::vector<BndTask> &tasks, int nthreads);
+  bool test() const { return started.remaining == 0; }
+  void wait() { help(started); }
+
+private:
+  /* tasks somebody waits for */
+  struct Batch {
+    std::atomic<int> remaining{0};
+  };
+
+  struct Item {
+    BndTask *task;
+    Batch *batch;
+  };
+
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Item> items;
+  };
+
+  void deal(std::vector<BndTask> &tasks, Batch &batch, int first, int n);
+  bool next(int id, Item &item);
+  void execute(const Item &item);
+  void help(Batch &batch);
+  void work(int id);
+
+  std::vector<std::unique_ptr<Queue>> queues;
+  std::vector<std::thread> threads;
+
+  /* guards sleeping and waking up; queued counts the items in the
+     deques and is raised under it, so that no wake-up is lost */
+  std::mutex mutex;
+  std::condition_variable wakeup;
+  std::atomic<int> queued{0};
+  bool stopping = false;
+
+  Batch started;
+};
+
+TaskPool::TaskPool(int nworkers) {
+  for (int i = 0; i <= nworkers; i++) {
+    queues.emplace_back(new Queue);
+  }
+  for (int i = 1; i <= nworkers; i++) {
+    threads.emplace_back(&TaskPool::work, this, i);
+  }
+}
+
+TaskPool::~TaskPool() {
+  wait();
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  wakeup.notify_all();
+  for (std::thread &t : threads) {
+    t.join();
+  }
+}
+
+/**
+ * Queue the tasks largest first on the n deques from first on, so that
+ * every deque is sorted by cost, and wake up the threads.
+ */
+void TaskPool::deal(std::vector<BndTask> &tasks, Batch &batch, int first,
+                    int n) {
+  std::vector<BndTask *> order;
+  for (BndTask &t : tasks) {
+    order.push_back(&t);
+  }
+  std::stable_sort(order.begin(), order.end(),
+                   [](const BndTask *a, const BndTask *b) {
+                     return a->cost > b->cost;
+                   });
+
+  const int nqueues = queues.size();
+  batch.remaining = order.size();
+  for (int q = 0; q < n; q++) {
+    Queue &queue = *queues[(first + q) % nqueues];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    for (size_t i = q; i < order.size(); i += n) {
+      queue.items.push_back(Item{order[i], &batch});
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    queued += order.size();
+  }
+  wakeup.notify_all();
+}
+
+bool TaskPool::next(int id, Item &item) {
+  const int n = queues.size();
+  {
+    Queue &q = *queues[id];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if (!q.items.empty()) {
+      item = q.items.front();
+      q.items.pop_front();
+      queued--;
+      return true;
+    }
+  }
+  for (int i = 1; i < n; i++) {
+    Queue &q = *queues[(id + i) % n];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if (!q.items.empty()) {
+      item = q.items.back();
+      q.items.pop_back();
+      queued--;
+      return true;
+    }
+  }
+  return false;
+}
+
+void TaskPool::execute(const Item &item) {
+  const bool was_in_pool = in_pool;
+  in_pool = true;
+  item.task->retval = item.task->run();
+  in_pool = was_in_pool;
+  /* the waiter may free the batch as soon as it reaches zero */
+  if (--item.batch->remaining == 0) {
+    std::lock_guard<std::mutex> lock(mutex);
+    wakeup.notify_all();
+  }
+}
+
+/**
+ * Run queued tasks, of this batch or others, until the batch is done.
+ */
+void TaskPool::help(Batch &batch) {
+  Item item;
+  while (batch.remaining > 0) {
+    if (next(queue_id, item)) {
+      execute(item);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    wakeup.wait(lock, [&] { return batch.remaining == 0 || queued > 0; });
+  }
+}
+
+void TaskPool::work(int id) {
+  queue_id = id;
+  Item item;
+  for (;;) {
+    if (next(id, item)) {
+      execute(item);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    wakeup.wait(lock, [this] { return queued > 0 || stopping; });
+    if (stopping && queued <= 0) {
+      return;
+    }
+  }
+}
+
+void TaskPool::run(std::vector<BndTask> &tasks, int nthreads) {
+  Batch batch;
+  deal(tasks, batch, queue_id, std::min<int>(nthreads, queues.size()));
+  help(batch);
+}
+
+void TaskPool::start(std::vector<BndTask> &tasks, int nthreads) {
+  wait();
+  /* the deques of the pool's own threads, as the caller goes on with
+     other work */
+  const int nworkers = threads.size();
+  deal(tasks, started, 1, std::max(1, std::min(nthreads, nworkers)));
+}
+
+int TaskPoolThreads() {
+  DECLARE_CCTK_PARAMETERS;
+  if (task_pool_threads > 0) {
+    return task_pool_threads;
+  }
+#ifdef _OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+/* created on first use; destroyed, which joins the threads, by
+   ShutdownTaskPool or at exit */
+static std::unique_ptr<TaskPool> pool;
+static std::mutex pool_mutex;
+
+static TaskPool &GetTaskPool() {
+  std::lock_guard<std::mutex> lock(pool_mutex);
+  if (!pool) {
+    /* the calling thread makes up the rest; one thread at least, so
+       that started tasks always run in the background */
+    pool.reset(new TaskPool(std::max(1, TaskPoolThreads() - 1)));
+  }
+  return *pool;
+}
+
+void RunTasks(std::vector<BndTask> &tasks, int nthreads) {
+  if (nthreads > 1 && tasks.size() > 1) {
+    GetTaskPool().run(tasks, nthreads);
+    return;
+  }
+  for (BndTask &t : tasks) {
+    t.retval = t.run();
+  }
+}
+
+void StartTasks(std::vector<BndTask> &tasks, int nthreads) {
+  if (tasks.empty()) {
+    WaitTasks();
+    return;
+  }
+  GetTaskPool().start(tasks, nthreads);
+}
+
+void WaitTasks() {
+  if (pool) {
+    pool->wait();
+  }
+}
+
+bool TestTasks() { return !pool || pool->test(); }
+
+void ShutdownTaskPool() {
+  std::lock_guard<std::mutex> lock(pool_mutex);
+  pool.reset();
+}
+
+} // namespace Boundary2
+
+/*@@
+   @routine    BndInTaskPool2
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Returns true while the calling thread executes boundary
+               tasks of the pool. Kernels then run serially instead of
+               starting OpenMP threads of their own.
+   @enddesc
+@@*/
+extern "C" int BndInTaskPool2(void) { return Boundary2::in_pool; }
+
+/*@@
+   @routine    Boundary2_ShutdownTaskPool
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Wait for boundary tasks which are still running and stop
+               the threads of the task pool
+   @enddesc
+@@*/
+extern "C" void Boundary2_ShutdownTaskPool(CCTK_ARGUMENTS) {
+  Boundary2::ShutdownTaskPool();
+}
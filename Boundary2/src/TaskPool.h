@@ -0,0 +1,78 @@
+/*@@
+  @file      TaskPool.h
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Work-stealing pool of persistent threads used to apply the
+             boundary conditions of a sync as independent tasks
+  @enddesc
+  @version   $Header$
+@@*/
+
+#ifndef _TASKPOOL_H_
+#define _TASKPOOL_H_
+
+#ifndef __cplusplus
+#error "TaskPool.h can only be used from C++"
+#endif
+
+#include <functional>
+#include <vector>
+
+#include "cctk.h"
+
+namespace Boundary2 {
+
+/**
+ * A unit of boundary work. The cost is only used to order and
+ * distribute the tasks; the return value of run() is stored in retval.
+ */
+struct BndTask {
+  std::function<CCTK_INT()> run;
+  double cost;
+  CCTK_INT retval;
+};
+
+/**
+ * Number of threads (including the calling one) the pool works with.
+ */
+int TaskPoolThreads();
+
+/**
+ * Run all tasks and return once they are finished. With nthreads > 1
+ * the tasks are dealt out largest first to nthreads threads, the
+ * calling one and nthreads-1 threads of the pool, and the calling
+ * thread works on them until all are done; otherwise they run inline
+ * in order. Tasks may call RunTasks() themselves.
+ */
+void RunTasks(std::vector<BndTask> &tasks, int nthreads);
+
+/**
+ * Hand the tasks to up to nthreads threads of the pool and return at
+ * once, so that the caller can post messages or do other work while
+ * they run. The tasks must stay alive until WaitTasks() returns. Tasks
+ * started earlier are waited for first.
+ */
+void StartTasks(std::vector<BndTask> &tasks, int nthreads);
+
+/**
+ * Work on the tasks handed out by StartTasks(), if any, until they are
+ * finished.
+ */
+void WaitTasks();
+
+/**
+ * Return whether the tasks handed out by StartTasks() are finished, so
+ * that WaitTasks() would return at once. Never blocks.
+ */
+bool TestTasks();
+
+/**
+ * Wait for the started tasks and stop the threads of the pool. The
+ * pool is created again when it is next used.
+ */
+void ShutdownTaskPool();
+
+} // namespace Boundary2
+
+#endif /* _TASKPOOL_H_ */
@@ -0,0 +1,186 @@
+/*@@
+  @file      Threads.c
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Decide whether the boundary kernels should run multithreaded
+  @enddesc
+  @history
+  @hdate
+  @hauthor
+  @hdesc
+  @endhistory
+@@*/
+
+#include "cctk.h"
+#include "cctk_Parameters.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "Boundary2.h"
+
+/********************************************************************
+ ********************* Externally visible helpers *******************
+ ********************************************************************/
+
+/*@@
+  @routine    BndUseThreads2
+  @date       Sun Oct 18 2026
+  @author     Samuel Cupp
+  @desc
+              Tells a boundary kernel whether to spread a loop touching
+              npoints boundary points over OpenMP threads.  Small loops
+              are run serially, since the cost of starting a parallel
+              region is larger than the work itself.
+
+              Threaded loops only partition independent rows, so results
+              are bitwise identical to a serial run.  Kernels called
+              from the boundary task pool always run serially, the pool
+              already keeps all threads busy.
+  @enddesc
+  @calls      BndInTaskPool2, BndCountThreads2
+  @history
+  @hdate      Sun Oct 18 2026
+  @hauthor    Samuel Cupp
+  @hdesc      Record the threads of a threaded loop for the timer of
+              the BC call
+  @endhistory
+  @var        npoints
+  @vdesc      number of grid points the loop will touch
+  @vtype      CCTK_INT
+  @vio        in
+  @endvar
+  @returntype int
+  @returndesc
+              1 if the loop should be threaded, 0 otherwise
+  @endreturndesc
+@@*/
+
+int BndUseThreads2(CCTK_INT npoints) {
+#ifdef _OPENMP
+  DECLARE_CCTK_PARAMETERS;
+  const int threaded = use_openmp && npoints >= omp_min_points &&
+                       omp_get_max_threads() > 1 && !omp_in_parallel() &&
+                       !BndInTaskPool2();
+
+  if (threaded) {
+    BndCountThreads2(omp_get_max_threads());
+  }
+  return threaded;
+#else
+  return 0;
+#endif
+}
+
+/*@@
+  @routine    BndFaceRows2
+  @date       Sun Oct 18 2026
+  @author     Samuel Cupp
+  @desc
+              Describes the rows along x of the boundary zones of the
+              lower and upper face of one direction, which the kernels
+              spread over threads as (variable, face, row) work items.
+  @enddesc
+  @history
+  @endhistory
+  @var        num_vars
+  @vdesc      number of variables of the run
+  @vtype      int
+  @vio        in
+  @endvar
+  @var        lower_extent, upper_extent
+  @vdesc      extent of the boundary zone of the lower and upper face,
+              or NULL if the face is skipped
+  @vtype      const int [3]
+  @vio        in
+  @endvar
+  @returntype BndRows2
+  @returndesc
+              the rows of both faces
+  @endreturndesc
+@@*/
+
+BndRows2 BndFaceRows2(int num_vars, const int *lower_extent,
+                      const int *upper_extent) {
+  BndRows2 rows;
+  const int *extent[2];
+  int s;
+
+  extent[0] = lower_extent;
+  extent[1] = upper_extent;
+  rows.num_vars = num_vars;
+  for (s = 0; s < 2; s++) {
+    const int empty = !extent[s] || extent[s][0] <= 0 || extent[s][1] <= 0 ||
+                      extent[s][2] <= 0;
+    rows.ny[s] = empty ? 0 : extent[s][1];
+    rows.nz[s] = empty ? 0 : extent[s][2];
+  }
+  return rows;
+}
+
+/*@@
+  @routine    BndRowsShare2
+  @date       Sun Oct 18 2026
+  @author     Samuel Cupp
+  @desc
+              Splits the rows into contiguous, equally sized shares for
+              the threads of the current parallel region, as a static
+              schedule would, and finds the first row of the calling
+              thread's share.  A serial caller gets all the rows, even
+              when it runs on a thread of an enclosing region.  Only this first row needs a division; the
+              kernels go through a plane of rows at a time and step to
+              the next one with BND_NEXT_PLANE2.
+  @enddesc
+  @history
+  @endhistory
+  @var        rows
+  @vdesc      the rows of both faces of a direction
+  @vtype      const BndRows2 *
+  @vio        in
+  @endvar
+  @var        threaded
+  @vdesc      whether the caller is one of the threads sharing the rows
+  @vtype      int
+  @vio        in
+  @endvar
+  @var        row
+  @vdesc      set to the first row of the share
+  @vtype      BndRow2 *
+  @vio        out
+  @endvar
+  @returntype int
+  @returndesc
+              number of rows in the share
+  @endreturndesc
+@@*/
+
+int BndRowsShare2(const BndRows2 *rows, int threaded, BndRow2 *row) {
+  const long per_face[2] = {(long)rows->ny[0] * rows->nz[0],
+                            (long)rows->ny[1] * rows->nz[1]};
+  const long per_var = per_face[0] + per_face[1];
+  const long total = rows->num_vars * per_var;
+  long begin = 0, end = total, rest;
+#ifdef _OPENMP
+  if (threaded) {
+    const int nthreads = omp_get_num_threads(), id = omp_get_thread_num();
+
+    begin = total * id / nthreads;
+    end = total * (id + 1) / nthreads;
+  }
+#endif
+
+  if (begin >= end) {
+    return 0;
+  }
+  row->var = begin / per_var;
+  rest = begin % per_var;
+  row->upper = rest >= per_face[0];
+  if (row->upper) {
+    rest -= per_face[0];
+  }
+  row->k = rest / rows->ny[row->upper];
+  row->j = rest % rows->ny[row->upper];
+  return end - begin;
+}
@@ -0,0 +1,403 @@
+/*@@
+  @file      Timers.cc
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Timers for the boundary conditions applied by the task
+             engine.
+
+             Every call of a BC function made by the engine is timed
+             and accumulated per BC, variable group, faces and
+             refinement level, summing the time of all threads.  Each
+             BC also gets a Cactus timer, which measures the wall time
+             during which at least one call of it was running.  The
+             time spent since the previous analysis is exported in the
+             grid scalars bc_times, and a breakdown can be printed at
+             termination.
+
+             The kernels also record the memory traffic and flops of
+             their loops according to a simple model (BndCountWork2),
+             so that the breakdown can show the achieved bandwidth and
+             flop rate of each BC next to the bandwidth of a STREAM
+             triad measured on the node with as many threads as the
+             calls of the BC used.
+  @enddesc
+  @version   $Header$
+@@*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "cctk.h"
+#include "cctk_Arguments.h"
+#include "cctk_Parameters.h"
+
+#include "Boundary2.h"
+#include "Timers.h"
+#include "Trace.h"
+
+namespace Boundary2 {
+
+struct BndTimerKey {
+  std::string bc_name;
+  int group;
+  CCTK_INT faces;
+  int levfac;
+  int threads;
+  bool operator<(const BndTimerKey &k) const {
+    return std::tie(bc_name, group, faces, levfac, threads) <
+           std::tie(k.bc_name, k.group, k.faces, k.levfac, k.threads);
+  }
+};
+
+struct BndTimerAcc {
+  double total, since_update;
+  long calls;
+  double points, bytes, flops;
+};
+
+/* the modelled work done by the calling thread so far, see
+   BndCountWork2 */
+static thread_local double work_points = 0, work_bytes = 0, work_flops = 0;
+
+/* the most threads a kernel loop of the BC call which the calling
+   thread runs has used so far, see BndCountThreads2 */
+static thread_local int work_threads = 1;
+
+/* the Cactus timer of a BC and the number of its calls now running */
+struct BndCactusTimer {
+  int handle;
+  int active;
+};
+
+static std::mutex timers_mutex;
+static std::map<BndTimerKey, BndTimerAcc> timers;
+static std::map<std::string, BndCactusTimer> cactus_timers;
+
+BndTimer::BndTimer(const cGH *cctkGH, const std::string &bc_name_,
+                   const CCTK_INT *vars_, int nvars_, CCTK_INT faces_,
+                   const std::string *members_)
+    : bc_name(bc_name_), members(members_), vars(vars_), nvars(nvars_),
+      levfac(cctkGH->cctk_levfac[0]), faces(faces_) {
+  DECLARE_CCTK_PARAMETERS;
+  enabled = collect_timers;
+  counting = false;
+  if (enabled) {
+    std::lock_guard<std::mutex> lock(timers_mutex);
+    auto it = cactus_timers.find(bc_name);
+    if (it == cactus_timers.end()) {
+      const std::string name = "Boundary2: " + bc_name;
+      BndCactusTimer t = {CCTK_TimerCreate(name.c_str()), 0};
+      it = cactus_timers.insert(std::make_pair(bc_name, t)).first;
+    }
+    if (it->second.handle >= 0 && it->second.active++ == 0) {
+      CCTK_TimerStartI(it->second.handle);
+    }
+  }
+  if (perf_counters) {
+    counting = BndPerfRead(start_counts);
+  }
+  start_points = work_points;
+  start_bytes = work_bytes;
+  start_flops = work_flops;
+  start_threads = work_threads;
+  work_threads = 1;
+  tracing = trace_timeline;
+  if (tracing) {
+    trace_start = BndTraceNow();
+  }
+  start = std::chrono::steady_clock::now();
+}
+
+BndTimer::~BndTimer() {
+  const std::chrono::steady_clock::time_point stop =
+      std::chrono::steady_clock::now();
+  if (counting) {
+    long long end_counts[BND_PERF_NCOUNTERS];
+    BndPerfRead(end_counts);
+    BndPerfAdd(bc_name, faces, start_counts, end_counts);
+  }
+  if (tracing) {
+    BndTraceEvent(bc_name.c_str(), "bc", trace_start, vars, nvars, faces,
+                  levfac);
+  }
+  const int threads = work_threads;
+  work_threads = std::max(start_threads, threads);
+  if (!enabled) {
+    return;
+  }
+  const double seconds =
+      std::chrono::duration<double>(stop - start).count();
+  std::lock_guard<std::mutex> lock(timers_mutex);
+  /* the variables of a call have the same shape, faces and width, so
+     each has the same share of the points; a call batched across
+     groups is split by group, a fused one also by BC */
+  std::map<std::pair<std::string, int>, int> nshares;
+  for (int v = 0; v < nvars; v++) {
+    const int group = CCTK_GroupIndexFromVarI(vars[v]);
+    nshares[std::make_pair(members ? members[v] : bc_name, group)]++;
+  }
+  for (const auto &kv : nshares) {
+    const double share = double(kv.second) / nvars;
+    const BndTimerKey key = {kv.first.first, kv.first.second, faces, levfac,
+                             threads};
+    BndTimerAcc &acc = timers[key];
+    acc.total += share * seconds;
+    acc.since_update += share * seconds;
+    acc.calls++;
+    acc.points += share * (work_points - start_points);
+    acc.bytes += share * (work_bytes - start_bytes);
+    acc.flops += share * (work_flops - start_flops);
+  }
+  BndCactusTimer &t = cactus_timers[bc_name];
+  if (t.handle >= 0 && --t.active == 0) {
+    CCTK_TimerStopI(t.handle);
+  }
+}
+
+std::string BndFacesName(CCTK_INT faces) {
+  if (faces == CCTK_ALL_FACES) {
+    return "all";
+  }
+  std::string name;
+  for (int f = 0; f < 6; f++) {
+    if (faces & (1 << f)) {
+      if (!name.empty()) {
+        name += " ";
+      }
+      name += char('x' + f / 2);
+      name += f % 2 ? "+" : "-";
+    }
+  }
+  return name.empty() ? "none" : name;
+}
+
+bool BndSecondsPerPoint(const std::string &bc_name, double &seconds) {
+  std::lock_guard<std::mutex> lock(timers_mutex);
+  double total = 0, points = 0;
+  for (const auto &kv : timers) {
+    if (kv.first.bc_name == bc_name) {
+      total += kv.second.total;
+      points += kv.second.points;
+    }
+  }
+  if (points <= 0) {
+    return false;
+  }
+  seconds = total / points;
+  return true;
+}
+
+void BndTimerTotals(double &seconds, double &points) {
+  std::lock_guard<std::mutex> lock(timers_mutex);
+  seconds = points = 0;
+  for (const auto &kv : timers) {
+    seconds += kv.second.total;
+    points += kv.second.points;
+  }
+}
+
+/**
+ * Bandwidth of a STREAM triad a = b + s * c on arrays much larger than
+ * the caches, in bytes per second, best of a few runs with the given
+ * number of threads. Write allocation is not counted, as in STREAM.
+ */
+static double BndStreamBandwidth(int nthreads) {
+  const long n = 1L << 22;
+  std::vector<double> a(n), b(n, 1.0), c(n, 2.0);
+  double *const pa = a.data();
+  const double *const pb = b.data(), *const pc = c.data();
+  double best = 0;
+  for (int run = 0; run < 5; run++) {
+    const std::chrono::steady_clock::time_point t0 =
+        std::chrono::steady_clock::now();
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (long i = 0; i < n; i++) {
+      pa[i] = pb[i] + 3.0 * pc[i];
+    }
+    const double seconds = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - t0)
+                               .count();
+    if (seconds > 0) {
+      best = std::max(best, 3 * sizeof(double) * n / seconds);
+    }
+  }
+  return best;
+}
+
+} // namespace Boundary2
+
+/*@@
+   @routine    BndCountWork2
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Record the modelled memory traffic and flops of a kernel
+               loop over npoints boundary points.  The work is added to
+               the timer of the BC call which the calling thread is
+               running, if any; kernels call this outside their OpenMP
+               regions.
+   @enddesc
+@@*/
+extern "C" void BndCountWork2(CCTK_INT npoints, int bytes_per_point,
+                              int flops_per_point) {
+  Boundary2::work_points += npoints;
+  Boundary2::work_bytes += double(npoints) * bytes_per_point;
+  Boundary2::work_flops += double(npoints) * flops_per_point;
+}
+
+/*@@
+   @routine    BndCountThreads2
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Record that a kernel loop of the BC call which the
+               calling thread is running, if any, is spread over
+               nthreads threads, so that its bandwidth can be compared
+               with a triad on as many threads
+   @enddesc
+@@*/
+extern "C" void BndCountThreads2(int nthreads) {
+  Boundary2::work_threads = std::max(Boundary2::work_threads, nthreads);
+}
+
+/*@@
+   @routine    Boundary2_UpdateTimerScalars
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Store the time spent in each BC since the previous call
+               in the grid scalars bc_times, so that it can be output
+               with the other scalars
+   @enddesc
+@@*/
+extern "C" void Boundary2_UpdateTimerScalars(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+  using namespace Boundary2;
+
+  static const char *const names[] = {"scalar",      "flat",    "radiation",
+                                      "copy",        "robin",   "static",
+                                      "extrapolate", "outflow", "none"};
+  CCTK_REAL *const scalars[] = {bc_time_scalar, bc_time_flat,
+                                bc_time_radiation, bc_time_copy,
+                                bc_time_robin, bc_time_static,
+                                bc_time_extrapolate, bc_time_outflow,
+                                bc_time_none};
+  const int nnames = sizeof names / sizeof *names;
+
+  for (int i = 0; i < nnames; i++) {
+    *scalars[i] = 0;
+  }
+  *bc_time_other = 0;
+  *bc_time_total = 0;
+
+  std::lock_guard<std::mutex> lock(timers_mutex);
+  for (auto &kv : timers) {
+    const double seconds = kv.second.since_update;
+    kv.second.since_update = 0;
+    int i = 0;
+    while (i < nnames && kv.first.bc_name != names[i]) {
+      i++;
+    }
+    *(i < nnames ? scalars[i] : bc_time_other) += seconds;
+    *bc_time_total += seconds;
+  }
+}
+
+/*@@
+   @routine    Boundary2_ReportTimers
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Print the accumulated BC times, largest first, and the
+               bandwidth and flop rate each BC achieved according to
+               the work recorded by the kernels, next to the bandwidth
+               of a STREAM triad on as many threads as its calls used
+   @enddesc
+@@*/
+extern "C" void Boundary2_ReportTimers(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_PARAMETERS;
+  using namespace Boundary2;
+
+  if (!print_timers) {
+    return;
+  }
+
+  std::vector<std::pair<BndTimerKey, BndTimerAcc>> rows;
+  {
+    std::lock_guard<std::mutex> lock(timers_mutex);
+    rows.assign(timers.begin(), timers.end());
+  }
+  std::stable_sort(rows.begin(), rows.end(),
+                   [](const std::pair<BndTimerKey, BndTimerAcc> &a,
+                      const std::pair<BndTimerKey, BndTimerAcc> &b) {
+                     return a.second.total > b.second.total;
+                   });
+  double total = 0;
+  for (const auto &row : rows) {
+    total += row.second.total;
+  }
+
+  CCTK_VInfo(CCTK_THORNSTRING,
+             "Time spent in boundary conditions: %g s (summed over threads)",
+             total);
+  CCTK_VInfo(CCTK_THORNSTRING, "%12s  %-30s %-18s %6s %7s %10s %12s %8s %8s",
+             "bc", "group", "faces", "levfac", "threads", "calls", "seconds",
+             "GB/s", "GFlop/s");
+  /* per BC and number of threads its calls used */
+  std::map<std::pair<std::string, int>, BndTimerAcc> bcs;
+  for (const auto &row : rows) {
+    const BndTimerKey &k = row.first;
+    const BndTimerAcc &acc = row.second;
+    const double seconds = acc.total > 0 ? acc.total : 1;
+    char *group = CCTK_GroupName(k.group);
+    CCTK_VInfo(CCTK_THORNSTRING,
+               "%12s  %-30s %-18s %6d %7d %10ld %12.6f %8.2f %8.2f",
+               k.bc_name.c_str(), group ? group : "?",
+               BndFacesName(k.faces).c_str(), k.levfac, k.threads, acc.calls,
+               acc.total, acc.bytes / seconds * 1e-9,
+               acc.flops / seconds * 1e-9);
+    free(group);
+    BndTimerAcc &sum = bcs[std::make_pair(k.bc_name, k.threads)];
+    sum.total += acc.total;
+    sum.calls += acc.calls;
+    sum.bytes += acc.bytes;
+    sum.flops += acc.flops;
+  }
+
+  /* a call runs on one thread unless its kernels thread their loops,
+     so each BC is compared with the triad on the threads it used */
+  std::map<int, double> stream;
+  for (const auto &kv : bcs) {
+    if (!stream.count(kv.first.second)) {
+      stream[kv.first.second] = BndStreamBandwidth(kv.first.second);
+      CCTK_VInfo(CCTK_THORNSTRING, "STREAM triad: %.2f GB/s on %d thread%s",
+                 stream[kv.first.second] * 1e-9, kv.first.second,
+                 kv.first.second == 1 ? "" : "s");
+    }
+  }
+  CCTK_VInfo(CCTK_THORNSTRING, "%12s  %7s %12s %10s %10s %8s %8s %7s %8s  %s",
+             "bc", "threads", "seconds", "GB", "GFlop", "GB/s", "GFlop/s",
+             "Flop/B", "%STREAM", "bound");
+  for (const auto &kv : bcs) {
+    const BndTimerAcc &acc = kv.second;
+    if (acc.bytes <= 0 || acc.total <= 0) {
+      continue;
+    }
+    const double bandwidth = acc.bytes / acc.total;
+    const double triad = stream.at(kv.first.second);
+    CCTK_VInfo(CCTK_THORNSTRING,
+               "%12s  %7d %12.6f %10.3f %10.3f %8.2f %8.2f %7.2f %7.0f%%  %s",
+               kv.first.first.c_str(), kv.first.second, acc.total,
+               acc.bytes * 1e-9, acc.flops * 1e-9, bandwidth * 1e-9,
+               acc.flops / acc.total * 1e-9, acc.flops / acc.bytes,
+               100 * bandwidth / triad,
+               bandwidth >= 0.5 * triad ? "bandwidth" : "latency");
+  }
+}
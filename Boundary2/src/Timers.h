@@ -0,0 +1,83 @@
+/*@@
+  @file      Timers.h
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Timers for the boundary conditions applied by the task
+             engine, broken down by BC, group, faces and level
+  @enddesc
+  @version   $Header$
+@@*/
+
+#ifndef _TIMERS_H_
+#define _TIMERS_H_
+
+#ifndef __cplusplus
+#error "Timers.h can only be used from C++"
+#endif
+
+#include <chrono>
+#include <string>
+
+#include "cctk.h"
+
+#include "PerfCounters.h"
+
+namespace Boundary2 {
+
+/**
+ * Times one call of a BC function for the nvars variables in vars, from
+ * construction to destruction, and adds it to the accumulator of
+ * its BC, group, faces, refinement level and the number of threads its
+ * kernel loops used. Safe to use from several
+ * threads at once. The Cactus timer "Boundary2: <bc>" runs while at
+ * least one call of that BC is timed. With perf_counters set, the
+ * hardware counters of the call are accumulated as well, and with
+ * trace_timeline it is recorded in the trace (see Trace.h).
+ *
+ * A fused call (see Fused.h) passes the BC of each variable in
+ * members. Its time and work are then accumulated for those BCs rather
+ * than under its own name, split by the points of their variables, so
+ * that the times of the BCs stay complete.
+ */
+class BndTimer {
+public:
+  BndTimer(const cGH *cctkGH, const std::string &bc_name,
+           const CCTK_INT *vars, int nvars, CCTK_INT faces,
+           const std::string *members = nullptr);
+  ~BndTimer();
+
+private:
+  BndTimer(const BndTimer &);
+  BndTimer &operator=(const BndTimer &);
+
+  bool enabled, counting, tracing;
+  const std::string &bc_name;
+  const std::string *members;
+  const CCTK_INT *vars;
+  int nvars, levfac;
+  CCTK_INT faces;
+  std::chrono::steady_clock::time_point start;
+  double start_points, start_bytes, start_flops, trace_start;
+  int start_threads;
+  long long start_counts[BND_PERF_NCOUNTERS];
+};
+
+/**
+ * The time spent in all timed BC calls of this process so far, summed
+ * over threads, and the number of boundary points they recorded.
+ */
+void BndTimerTotals(double &seconds, double &points);
+
+/**
+ * The measured time per boundary point of a BC, from the timed calls
+ * of it which recorded points. Returns false if there were none.
+ */
+bool BndSecondsPerPoint(const std::string &bc_name, double &seconds);
+
+/** faces as e.g. "x- x+ y-", or "all" */
+std::string BndFacesName(CCTK_INT faces);
+
+} // namespace Boundary2
+
+#endif /* _TIMERS_H_ */
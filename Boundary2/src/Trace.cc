@@ -0,0 +1,226 @@
+/*@@
+  @file      Trace.cc
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Timeline of the boundary conditions, written as a Chrome
+             trace.
+
+             With trace_timeline set, every BC call made by the task
+             engine and the phases of the engine (applying the BCs
+             before and after the sync, waiting for BCs running in the
+             background) are recorded as events with their thread and
+             refinement level.  Each thread appends to its own ring
+             buffer, which keeps the last trace_buffer_events events.
+             At termination all buffers are written as a JSON file
+             which chrome://tracing or Perfetto can display.
+  @enddesc
+  @version   $Header$
+@@*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cctk.h"
+#include "cctk_Arguments.h"
+#include "cctk_Parameters.h"
+
+#include "Timers.h"
+#include "Trace.h"
+
+namespace Boundary2 {
+
+struct BndTraceRecord {
+  char name[32];
+  const char *cat;
+  double start, end;
+  /* the variables of a BC call, which a run need not take from one
+     contiguous range; the vector keeps its storage when the slot is
+     reused */
+  std::vector<int> vars;
+  CCTK_INT faces;
+  int levfac;
+};
+
+/* the ring buffer of one thread, only written by that thread */
+struct BndTraceBuffer {
+  int tid;
+  std::vector<BndTraceRecord> events;
+  unsigned long count;
+};
+
+static std::mutex trace_mutex;
+static std::vector<std::unique_ptr<BndTraceBuffer>> trace_buffers;
+static thread_local BndTraceBuffer *trace_buffer = NULL;
+
+double BndTraceNow() {
+  static const std::chrono::steady_clock::time_point origin =
+      std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(
+             std::chrono::steady_clock::now() - origin)
+      .count();
+}
+
+void BndTraceEvent(const char *name, const char *cat, double start,
+                   const CCTK_INT *vars, int nvars, CCTK_INT faces,
+                   int levfac) {
+  const double end = BndTraceNow();
+  if (!trace_buffer) {
+    DECLARE_CCTK_PARAMETERS;
+    std::unique_ptr<BndTraceBuffer> buffer(new BndTraceBuffer);
+    buffer->events.resize(std::max(1, int(trace_buffer_events)));
+    buffer->count = 0;
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    buffer->tid = trace_buffers.size();
+    trace_buffer = buffer.get();
+    trace_buffers.push_back(std::move(buffer));
+  }
+  BndTraceRecord &e =
+      trace_buffer->events[trace_buffer->count++ % trace_buffer->events.size()];
+  strncpy(e.name, name, sizeof e.name - 1);
+  e.name[sizeof e.name - 1] = '\0';
+  e.cat = cat;
+  e.start = start;
+  e.end = end;
+  e.vars.assign(vars, vars + nvars);
+  e.faces = faces;
+  e.levfac = levfac;
+}
+
+BndTraceSpan::BndTraceSpan(const cGH *cctkGH, const char *name_)
+    : name(name_), levfac(cctkGH->cctk_levfac[0]) {
+  DECLARE_CCTK_PARAMETERS;
+  enabled = trace_timeline;
+  if (enabled) {
+    start = BndTraceNow();
+  }
+}
+
+BndTraceSpan::~BndTraceSpan() {
+  if (enabled) {
+    BndTraceEvent(name, "engine", start, NULL, 0, 0, levfac);
+  }
+}
+
+/* s as a JSON string, quotes included */
+static std::string BndJsonString(const char *s) {
+  std::string json = "\"";
+  for (; *s; s++) {
+    const unsigned char c = *s;
+    if (c == '"' || c == '\\') {
+      json += '\\';
+      json += c;
+    } else if (c < 0x20) {
+      char escaped[8];
+      snprintf(escaped, sizeof escaped, "\\u%04x", c);
+      json += escaped;
+    } else {
+      json += c;
+    }
+  }
+  return json + "\"";
+}
+
+/* the full names of the variables of a call as a JSON array */
+static std::string BndTraceVars(const std::vector<int> &vars) {
+  std::string json = "[";
+  for (size_t i = 0; i < vars.size(); i++) {
+    char *name = CCTK_FullName(vars[i]);
+    json += (i ? "," : "") + BndJsonString(name ? name : "?");
+    free(name);
+  }
+  return json + "]";
+}
+
+} // namespace Boundary2
+
+/*@@
+   @routine    Boundary2_WriteTrace
+   @date       Sun Oct 18 2026
+   @author     Samuel Cupp
+   @desc
+               Write the recorded boundary events of this process as a
+               Chrome trace to trace_file.<proc>.json, in IO::out_dir
+               unless trace_file is an absolute path
+   @enddesc
+@@*/
+extern "C" void Boundary2_WriteTrace(CCTK_ARGUMENTS) {
+  DECLARE_CCTK_ARGUMENTS;
+  DECLARE_CCTK_PARAMETERS;
+  using namespace Boundary2;
+
+  if (!trace_timeline) {
+    return;
+  }
+
+  std::string filename = trace_file;
+  const void *out_dir =
+      filename[0] != '/' ? CCTK_ParameterGet("out_dir", "IO", NULL) : NULL;
+  if (out_dir && **(const char *const *)out_dir) {
+    filename = std::string(*(const char *const *)out_dir) + "/" + filename;
+  }
+  const int proc = CCTK_MyProc(cctkGH);
+  filename += "." + std::to_string(proc) + ".json";
+
+  FILE *file = fopen(filename.c_str(), "w");
+  if (!file) {
+    CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+               "Cannot write the boundary trace to '%s'", filename.c_str());
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(trace_mutex);
+  unsigned long written = 0, dropped = 0;
+  fprintf(file, "{\"traceEvents\":[\n");
+  for (const auto &buffer : trace_buffers) {
+    fprintf(file,
+            "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,"
+            "\"args\":{\"name\":\"boundary thread %d\"}},\n",
+            proc, buffer->tid, buffer->tid);
+    const unsigned long size = buffer->events.size();
+    const unsigned long first =
+        buffer->count > size ? buffer->count - size : 0;
+    dropped += first;
+    for (unsigned long i = first; i < buffer->count; i++) {
+      const BndTraceRecord &e = buffer->events[i % size];
+      fprintf(file,
+              "{\"name\":%s,\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,"
+              "\"dur\":%.3f,\"pid\":%d,\"tid\":%d,\"args\":{",
+              BndJsonString(e.name).c_str(), e.cat, e.start, e.end - e.start,
+              proc, buffer->tid);
+      if (!e.vars.empty()) {
+        fprintf(file, "\"vars\":%s,\"nvars\":%d,\"faces\":\"%s\",",
+                BndTraceVars(e.vars).c_str(), int(e.vars.size()),
+                BndFacesName(e.faces).c_str());
+      }
+      fprintf(file, "\"levfac\":%d}},\n", e.levfac);
+      written++;
+    }
+  }
+  /* a last metadata event, so that the list needs no trailing comma
+     handling */
+  fprintf(file,
+          "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+          "\"args\":{\"name\":\"process %d\"}}\n",
+          proc, proc);
+  fprintf(file, "],\"displayTimeUnit\":\"ms\",\"otherData\":{"
+                "\"dropped_events\":%lu}}\n",
+          dropped);
+  fclose(file);
+
+  CCTK_VInfo(CCTK_THORNSTRING, "Wrote %lu boundary events to '%s'", written,
+             filename.c_str());
+  if (dropped > 0) {
+    CCTK_VWarn(1, __LINE__, __FILE__, CCTK_THORNSTRING,
+               "%lu older boundary events were overwritten; increase "
+               "trace_buffer_events to keep them",
+               dropped);
+  }
+}
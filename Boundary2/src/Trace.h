@@ -0,0 +1,57 @@
+/*@@
+  @file      Trace.h
+  @date      Sun Oct 18 2026
+  @author    Samuel Cupp
+  @desc
+             Timeline of the boundary conditions, written as a Chrome
+             trace
+  @enddesc
+  @version   $Header$
+@@*/
+
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+#ifndef __cplusplus
+#error "Trace.h can only be used from C++"
+#endif
+
+#include "cctk.h"
+
+namespace Boundary2 {
+
+/** Microseconds since the first use of the trace clock */
+double BndTraceNow();
+
+/**
+ * Records an event from start (see BndTraceNow) until now in the ring
+ * buffer of the calling thread. The nvars variables in vars and faces
+ * describe a BC call; nvars is 0 for other events. Only the calling
+ * thread writes to its buffer, so no locks are taken.
+ */
+void BndTraceEvent(const char *name, const char *cat, double start,
+                   const CCTK_INT *vars, int nvars, CCTK_INT faces,
+                   int levfac);
+
+/**
+ * Traces a phase of the boundary engine from construction to
+ * destruction, if the trace parameter is set.
+ */
+class BndTraceSpan {
+public:
+  BndTraceSpan(const cGH *cctkGH, const char *name);
+  ~BndTraceSpan();
+
+private:
+  BndTraceSpan(const BndTraceSpan &);
+  BndTraceSpan &operator=(const BndTraceSpan &);
+
+  bool enabled;
+  const char *name;
+  int levfac;
+  double start;
+};
+
+} // namespace Boundary2
+
+#endif /* _TRACE_H_ */